@@ -27,12 +27,29 @@
 #include "AudioGeneration/AudioMixer.h"
 #include "AudioGeneration/Oscillator.h"
 #include "AudioGeneration/NoteFrequencyTable.h"
+#include "AudioGeneration/FilterCutoffTable.h"
 #include <math.h>
 #include <stddef.h>
 
-AudioMixer::AudioMixer() : sampleCount_(0), midiNoteIndex_(NO_MIDI_NOTE_)
+AudioMixer::AudioMixer() :
+    hardSync_(false),
+    fmAmount_(0),
+    fmDepth_(0.0f),
+    oversampling_(false),
+    pitchModulation_(1.0f),
+    levelModulation_(1.0f),
+    cutoffModulation_(0.0f),
+    pulseWidthModulation_(0.0f),
+    filterActive_(false),
+    effectsActive_(false),
+    midiNoteIndex_(NO_MIDI_NOTE_),
+    mixCenter_(0.0f),
+    lastOutput_(DAC_MIDPOINT_),
+    ditherState_(DITHER_SEED_),
+    ditherError_(0.0f)
 {
     InitializeNoteFrequencyTable();
+    InitializeFilterCutoffTable();
     SetupDefaultOscillatorValues();
 }
 
@@ -57,16 +74,133 @@ Oscillator& AudioMixer::GetOscillator3()
     return oscillator3_;
 }
 
+StateVariableFilter& AudioMixer::GetFilter()
+{
+    return filter_;
+}
+
+LFO& AudioMixer::GetLFO1()
+{
+    return lfo1_;
+}
+
+LFO& AudioMixer::GetLFO2()
+{
+    return lfo2_;
+}
+
+ModulationMatrix& AudioMixer::GetModulationMatrix()
+{
+    return modulationMatrix_;
+}
+
+Glide& AudioMixer::GetGlide()
+{
+    return glide_;
+}
+
+Tuning& AudioMixer::GetTuning()
+{
+    return tuning_;
+}
+
+Chorus& AudioMixer::GetChorus()
+{
+    return chorus_;
+}
+
+Delay& AudioMixer::GetDelay()
+{
+    return delay_;
+}
+
+Reverb& AudioMixer::GetReverb()
+{
+    return reverb_;
+}
+
+OutputStage& AudioMixer::GetOutputStage()
+{
+    return outputStage_;
+}
+
+bool AudioMixer::GetHardSync()
+{
+    return hardSync_;
+}
+
+uint8_t AudioMixer::GetFMAmount()
+{
+    return fmAmount_;
+}
+
+void AudioMixer::SetHardSync(bool hardSync)
+{
+    hardSync_ = hardSync;
+}
+
+void AudioMixer::SetFMAmount(uint8_t fmAmount)
+{
+    if(fmAmount > MAX_FM_AMOUNT)
+    {
+        fmAmount = MAX_FM_AMOUNT;
+    }
+
+    fmAmount_ = fmAmount;
+}
+
+bool AudioMixer::GetOversampling()
+{
+    return oversampling_;
+}
+
+void AudioMixer::SetOversampling(bool oversampling)
+{
+    oversampling_ = oversampling;
+}
+
 void AudioMixer::SetMIDINote(uint8_t midiNoteIndex)
 {
-    if(midiNoteIndex < MIDI_NOTE_COUNT_)
+    if(midiNoteIndex >= MIDI_NOTE_COUNT_)
     {
-        midiNoteIndex_ = midiNoteIndex;
+        midiNoteIndex = MIDI_NOTE_COUNT_ - 1;
     }
-    else
+
+    // The MIDI receiver hands us its most recently pressed key that's still held, so the same note
+    // comes through again when any other key is released.
+    if(midiNoteIndex == midiNoteIndex_)
+    {
+        return;
+    }
+
+    if(midiNoteIndex != NO_MIDI_NOTE_)
     {
-        midiNoteIndex_ = MIDI_NOTE_COUNT_ - 1;
+        bool overlapping = (midiNoteIndex_ != NO_MIDI_NOTE_);
+
+        // In legato mode a note played over a held one carries on from it rather than restarting
+        if(!overlapping || !glide_.GetLegato())
+        {
+            TriggerNote();
+        }
+
+        glide_.StartNote(midiNoteIndex, overlapping);
     }
+
+    midiNoteIndex_ = midiNoteIndex;
+}
+
+void AudioMixer::TriggerNote()
+{
+    // Don't let whatever was left ringing in the filter from the last note leak into a new one
+    filter_.Reset();
+
+    oscillator1_.ResetLevelSmoothing();
+    oscillator2_.ResetLevelSmoothing();
+    oscillator3_.ResetLevelSmoothing();
+
+    oscillator1_.RestartSample();
+    oscillator2_.RestartSample();
+    oscillator3_.RestartSample();
 }
 
 uint8_t AudioMixer::GetActiveOscillatorCount()
@@ -82,23 +216,305 @@ uint8_t AudioMixer::GetActiveOscillatorCount()
 
 void AudioMixer::GetAudioData(uint16_t buffer[], uint32_t bufferSampleSize)
 {
-    // Silent the audio buffer before adding audio to it through the oscillators
-    for(unsigned int i = 0 ; i < bufferSampleSize; ++i)
+    if(bufferSampleSize == 0)
     {
-        buffer[i] = 0;
+        return;
     }
 
-    // If no note is being played, no audio needed
     if(midiNoteIndex_ == NO_MIDI_NOTE_)
     {
+        // The effects can still be ringing after the note's let go, and the output stage's DC
+        // blocker has to settle rather than have its output cut off under it
+        if(GetEffectsEnabled() || outputStage_.GetEnabled())
+        {
+            RenderTail(buffer, bufferSampleSize);
+        }
+        else
+        {
+            WriteSilence(buffer, bufferSampleSize);
+        }
+    }
+    else
+    {
+        uint8_t totalOscillatorCount = GetActiveOscillatorCount();
+
+        uint32_t blockStart = 0;
+        while(blockStart < bufferSampleSize)
+        {
+            uint32_t blockSize = bufferSampleSize - blockStart;
+            if(blockSize > CONTROL_BLOCK_SIZE)
+            {
+                blockSize = CONTROL_BLOCK_SIZE;
+            }
+
+            ControlTick(totalOscillatorCount);
+            RenderBlock(&(buffer[blockStart]), blockSize);
+
+            blockStart += blockSize;
+        }
+    }
+
+    lastOutput_ = buffer[bufferSampleSize - 1];
+}
+
+// Runs once per control block, ahead of the block's audio.  Everything that doesn't have to change
+// every sample (modulation, smoothing, tuning and filter coefficients) is worked out here, so the
+// audio rate loops in RenderBlock only read values that are fixed for the block.
+void AudioMixer::ControlTick(uint8_t totalOscillatorCount)
+{
+    UpdateModulation();
+
+    // The oscillators work out their rate from SAMPLE_RATE, so when rendering at twice that rate
+    // they're asked for half the pitch.
+    float pitchModulation = oversampling_ ? (pitchModulation_ / OVERSAMPLING_FACTOR_) : pitchModulation_;
+
+    oscillator1_.StartBlock(totalOscillatorCount, midiNoteIndex_, tuning_, pitchModulation, levelModulation_, pulseWidthModulation_);
+    oscillator2_.StartBlock(totalOscillatorCount, midiNoteIndex_, tuning_, pitchModulation, levelModulation_, pulseWidthModulation_);
+    oscillator3_.StartBlock(totalOscillatorCount, midiNoteIndex_, tuning_, pitchModulation, levelModulation_, pulseWidthModulation_);
+
+    fmDepth_ = static_cast<float>(fmAmount_) * MAX_FM_DEPTH_ / MAX_FM_AMOUNT;
+    mixCenter_ = oscillator1_.GetCenterLevel() + oscillator2_.GetCenterLevel() + oscillator3_.GetCenterLevel();
+
+    filterActive_ = (filter_.GetMode() != Bypass);
+    if(filterActive_)
+    {
+        filter_.UpdateCoefficients(cutoffModulation_);
+    }
+
+    effectsActive_ = GetEffectsEnabled();
+}
+
+bool AudioMixer::GetEffectsEnabled()
+{
+    return (chorus_.GetMode() != Chorus::OFF || delay_.GetTime() != 0 || reverb_.GetMix() != 0);
+}
+
+// Runs silence through the effects and the output stage (and whatever the filter has left ringing)
+// while no note is held
+void AudioMixer::RenderTail(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    effectsActive_ = GetEffectsEnabled();
+
+    uint32_t blockStart = 0;
+    while(blockStart < bufferSampleSize)
+    {
+        uint32_t blockSize = bufferSampleSize - blockStart;
+        if(blockSize > CONTROL_BLOCK_SIZE)
+        {
+            blockSize = CONTROL_BLOCK_SIZE;
+        }
+
+        for(uint32_t i = 0; i < blockSize; ++i)
+        {
+            outputBlock_[i] = 0.0f;
+        }
+
+        ProcessOutput(&(buffer[blockStart]), blockSize);
+
+        blockStart += blockSize;
+    }
+}
+
+// Writes silence when there's nothing left to run through the effects or the output stage, which
+// settle to the same DAC midpoint
+void AudioMixer::WriteSilence(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    int32_t level = lastOutput_;
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        if(level < DAC_MIDPOINT_ - SILENCE_RAMP_STEP_) { level += SILENCE_RAMP_STEP_; }
+        else if(level > DAC_MIDPOINT_ + SILENCE_RAMP_STEP_) { level -= SILENCE_RAMP_STEP_; }
+        else { level = DAC_MIDPOINT_; }
+        buffer[i] = static_cast<uint16_t>(level);
+    }
+}
+
+void AudioMixer::RenderBlock(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    if(oversampling_)
+    {
+        RenderOscillators(oversampledSamples_, bufferSampleSize * OVERSAMPLING_FACTOR_);
+        ConvertToFloat(oversampledSamples_, oversampledBlock_, bufferSampleSize * OVERSAMPLING_FACTOR_);
+        decimator_.Process(oversampledBlock_, outputBlock_, bufferSampleSize);
+        ProcessOutput(buffer, bufferSampleSize);
+        return;
+    }
+
+    RenderOscillators(buffer, bufferSampleSize);
+
+    if(filterActive_ || effectsActive_ || outputStage_.GetEnabled())
+    {
+        ConvertToFloat(buffer, outputBlock_, bufferSampleSize);
+        ProcessOutput(buffer, bufferSampleSize);
         return;
     }
 
-    uint8_t totalOscillatorCount = GetActiveOscillatorCount();
+    // Unprocessed, the mix is moved to be centered on the DAC midpoint as well.  All the oscillators
+    // at full level already are, so this is usually nothing.
+    int32_t offset = DAC_MIDPOINT_ - static_cast<int32_t>(mixCenter_ + 0.5f);
+    if(offset != 0)
+    {
+        for(uint32_t i = 0; i < bufferSampleSize; ++i)
+        {
+            int32_t sample = static_cast<int32_t>(buffer[i]) + offset;
+            if(sample < 0) { sample = 0; }
+            else if(sample > DAC_MAX_) { sample = DAC_MAX_; }
+            buffer[i] = static_cast<uint16_t>(sample);
+        }
+    }
+}
+
+void AudioMixer::UpdateModulation()
+{
+    float sourceValues[ModulationMatrix::SOURCE_COUNT];
+    sourceValues[ModulationMatrix::NO_SOURCE] = 0.0f;
+    sourceValues[ModulationMatrix::LFO_1] = lfo1_.Tick();
+    sourceValues[ModulationMatrix::LFO_2] = lfo2_.Tick();
+
+    modulationMatrix_.Evaluate(sourceValues);
+
+    float pitchSemitones = modulationMatrix_.GetModulation(ModulationMatrix::PITCH) * PITCH_MODULATION_SEMITONES_ + glide_.Tick();
+    pitchModulation_ = (pitchSemitones != 0.0f) ? powf(2.0f, pitchSemitones / 12.0f) : 1.0f;
+
+    // The level can only be turned down (turning it up could overflow the mix)
+    levelModulation_ = 1.0f + modulationMatrix_.GetModulation(ModulationMatrix::LEVEL);
+    if(levelModulation_ < 0.0f) { levelModulation_ = 0.0f; }
+    else if(levelModulation_ > 1.0f) { levelModulation_ = 1.0f; }
+
+    cutoffModulation_ = modulationMatrix_.GetModulation(ModulationMatrix::FILTER_CUTOFF) * CUTOFF_MODULATION_RANGE_;
+    pulseWidthModulation_ = modulationMatrix_.GetModulation(ModulationMatrix::PULSE_WIDTH) * PULSE_WIDTH_MODULATION_RANGE_ / 100.0f;
+}
+
+void AudioMixer::RenderOscillators(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    // When the oscillators aren't linked, each one renders its block on its own, which is quicker
+    // than interleaving all three.
+    if(!hardSync_ && fmAmount_ == 0)
+    {
+        for(uint32_t i = 0; i < bufferSampleSize; ++i)
+        {
+            buffer[i] = 0;
+        }
 
-    oscillator1_.MixInOscillatorAudio(buffer, bufferSampleSize, totalOscillatorCount, midiNoteIndex_, sampleCount_);
-    oscillator2_.MixInOscillatorAudio(buffer, bufferSampleSize, totalOscillatorCount, midiNoteIndex_, sampleCount_);
-    oscillator3_.MixInOscillatorAudio(buffer, bufferSampleSize, totalOscillatorCount, midiNoteIndex_, sampleCount_);
+        oscillator1_.MixInOscillatorAudio(buffer, bufferSampleSize);
+        oscillator2_.MixInOscillatorAudio(buffer, bufferSampleSize);
+        oscillator3_.MixInOscillatorAudio(buffer, bufferSampleSize);
+        return;
+    }
+
+    const float fmDepth = fmDepth_;
+
+    // Oscillators 2 and 3 can depend on what oscillator 1 did in the same sample, so all three
+    // are rendered together one sample at a time.
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        uint16_t sample = static_cast<uint16_t>(oscillator1_.RenderSample(1.0f));
+
+        if(hardSync_ && oscillator1_.GetCycleRestarted())
+        {
+            oscillator2_.RestartCycle();
+            oscillator3_.RestartCycle();
+        }
+
+        float rateScale = 1.0f + fmDepth * oscillator1_.GetModulatorOutput();
+
+        sample += static_cast<uint16_t>(oscillator2_.RenderSample(rateScale));
+        sample += static_cast<uint16_t>(oscillator3_.RenderSample(rateScale));
+        buffer[i] = sample;
+    }
+}
+
+void AudioMixer::ConvertToFloat(const uint16_t input[], float output[], uint32_t sampleSize)
+{
+    const float mixCenter = mixCenter_;
+    for(uint32_t i = 0; i < sampleSize; ++i)
+    {
+        output[i] = static_cast<float>(input[i]) - mixCenter;
+    }
+}
+
+// Filters, adds the effects to and finishes off the block in outputBlock_, writing the result to
+// the buffer
+void AudioMixer::ProcessOutput(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    if(filterActive_)
+    {
+        filter_.Process(outputBlock_, bufferSampleSize);
+    }
+
+    if(effectsActive_)
+    {
+        if(chorus_.GetMode() != Chorus::OFF)
+        {
+            chorus_.Process(outputBlock_, bufferSampleSize);
+        }
+
+        if(delay_.GetTime() != 0)
+        {
+            delay_.Process(outputBlock_, bufferSampleSize);
+        }
+
+        if(reverb_.GetMix() != 0)
+        {
+            reverb_.Process(outputBlock_, bufferSampleSize);
+        }
+    }
+
+    if(outputStage_.GetEnabled())
+    {
+        outputStage_.Process(outputBlock_, bufferSampleSize);
+
+        if(outputStage_.GetDither())
+        {
+            WriteDitheredOutput(buffer, bufferSampleSize);
+            return;
+        }
+    }
+
+    // Resonance and feedback can push the signal past what the DAC can output, so clamp it
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        int32_t sample = static_cast<int32_t>(outputBlock_[i]) + DAC_MIDPOINT_;
+        if(sample < 0) { sample = 0; }
+        else if(sample > DAC_MAX_) { sample = DAC_MAX_; }
+        buffer[i] = static_cast<uint16_t>(sample);
+    }
+}
+
+void AudioMixer::WriteDitheredOutput(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    uint32_t ditherState = ditherState_;
+    float ditherError = ditherError_;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        // Triangular (TPDF) dither of +/-1 LSB is the sum of two independent uniform values, so
+        // it takes two draws from the generator (Marsaglia's xorshift32, as the noise oscillator
+        // uses), each giving its top 16 bits.
+        ditherState ^= ditherState << 13;
+        ditherState ^= ditherState >> 17;
+        ditherState ^= ditherState << 5;
+        int32_t firstUniform = static_cast<int32_t>(ditherState >> 16);
+        ditherState ^= ditherState << 13;
+        ditherState ^= ditherState >> 17;
+        ditherState ^= ditherState << 5;
+        int32_t secondUniform = static_cast<int32_t>(ditherState >> 16);
+        float dither = static_cast<float>(firstUniform + secondUniform - 0xFFFF) * (1.0f / 65536.0f);
+
+        // First-order error feedback: subtracting the last sample's rounding error shapes the
+        // noise by (1 - z^-1), moving it away from the low frequencies where it's most audible.
+        float target = outputBlock_[i] - ditherError + static_cast<float>(DAC_MIDPOINT_);
+
+        // Adding 1.0 keeps the value positive for anything the clamp below would let through, so
+        // truncating it is a floor.
+        int32_t sample = static_cast<int32_t>(target + dither + 0.5f + 1.0f) - 1;
+        ditherError = static_cast<float>(sample) - target;
+
+        if(sample < 0) { sample = 0; }
+        else if(sample > DAC_MAX_) { sample = DAC_MAX_; }
+        buffer[i] = static_cast<uint16_t>(sample);
+    }
 
-    sampleCount_ += bufferSampleSize;
+    ditherState_ = ditherState;
+    ditherError_ = ditherError;
 }
@@ -27,7 +27,18 @@
 #pragma once
 
 #include <stdint.h>
+#include <AudioGeneration/AudioSettings.h>
 #include <AudioGeneration/Oscillator.h>
+#include <AudioGeneration/StateVariableFilter.h>
+#include <AudioGeneration/LFO.h>
+#include <AudioGeneration/ModulationMatrix.h>
+#include <AudioGeneration/Glide.h>
+#include <AudioGeneration/Tuning.h>
+#include <AudioGeneration/Chorus.h>
+#include <AudioGeneration/Delay.h>
+#include <AudioGeneration/Reverb.h>
+#include <AudioGeneration/OutputStage.h>
+#include <AudioGeneration/HalfbandDecimator.h>
 
 class Oscillator;
 
@@ -39,6 +50,32 @@ class AudioMixer
         Oscillator& GetOscillator1();
         Oscillator& GetOscillator2();
         Oscillator& GetOscillator3();
+        StateVariableFilter& GetFilter();
+        LFO& GetLFO1();
+        LFO& GetLFO2();
+        ModulationMatrix& GetModulationMatrix();
+        Glide& GetGlide();
+        Tuning& GetTuning();
+        Chorus& GetChorus();
+        Delay& GetDelay();
+        Reverb& GetReverb();
+        OutputStage& GetOutputStage();
+
+        // Oscillator 1 can hard sync oscillators 2 and 3 (restart their cycles whenever it restarts
+        // its own) and frequency modulate them.  The FM is linear and through-zero: at the maximum
+        // amount oscillator 1 swings their rate from -3 to +5 times their own pitch.
+        bool GetHardSync();
+        uint8_t GetFMAmount();
+        void SetHardSync(bool hardSync);
+        void SetFMAmount(uint8_t fmAmount);
+
+        static const uint8_t MAX_FM_AMOUNT = 100;
+
+        // Renders the oscillators at twice the sample rate and decimates the result, which keeps
+        // most of the aliasing from sync and FM out of the audible range.  It roughly doubles
+        // the cost of the oscillators.
+        bool GetOversampling();
+        void SetOversampling(bool oversampling);
 
         void SetMIDINote(uint8_t midiNoteIndex);
         void GetAudioData(uint16_t buffer[], uint32_t bufferSampleSize);
@@ -46,15 +83,80 @@ class AudioMixer
     private:
         void SetupDefaultOscillatorValues();
         uint8_t GetActiveOscillatorCount();
+        void TriggerNote();
+        void ControlTick(uint8_t totalOscillatorCount);
+        void UpdateModulation();
+        bool GetEffectsEnabled();
+        void RenderTail(uint16_t buffer[], uint32_t bufferSampleSize);
+        void WriteSilence(uint16_t buffer[], uint32_t bufferSampleSize);
+        void RenderBlock(uint16_t buffer[], uint32_t bufferSampleSize);
+        void RenderOscillators(uint16_t buffer[], uint32_t bufferSampleSize);
+        void ConvertToFloat(const uint16_t input[], float output[], uint32_t sampleSize);
+        void ProcessOutput(uint16_t buffer[], uint32_t bufferSampleSize);
+        void WriteDitheredOutput(uint16_t buffer[], uint32_t bufferSampleSize);
 
         Oscillator oscillator1_;
         Oscillator oscillator2_;
         Oscillator oscillator3_;
+        StateVariableFilter filter_;
+        LFO lfo1_;
+        LFO lfo2_;
+        ModulationMatrix modulationMatrix_;
+        Glide glide_;
+        Tuning tuning_;
+        Chorus chorus_;
+        Delay delay_;
+        Reverb reverb_;
+        OutputStage outputStage_;
+
+        bool hardSync_;
+        uint8_t fmAmount_;
+        static const int32_t MAX_FM_DEPTH_ = 4;
+        float fmDepth_;
+
+        bool oversampling_;
+        static const uint32_t OVERSAMPLING_FACTOR_ = 2;
+        uint16_t oversampledSamples_[OVERSAMPLING_FACTOR_ * CONTROL_BLOCK_SIZE];
+        float oversampledBlock_[OVERSAMPLING_FACTOR_ * CONTROL_BLOCK_SIZE];
+        HalfbandDecimator decimator_;
+
+        // Modulation for the current control block (see ControlTick)
+        float pitchModulation_;
+        float levelModulation_;
+        float cutoffModulation_;
+        float pulseWidthModulation_;
+        bool filterActive_;
+        bool effectsActive_;
+
+        // A full amount routed to pitch moves it up/down an octave, a full amount routed to the
+        // cutoff moves it up/down 64 steps and a full amount routed to the pulse width moves it
+        // up/down 45%.
+        static const int32_t PITCH_MODULATION_SEMITONES_ = 12;
+        static const int32_t CUTOFF_MODULATION_RANGE_ = 64;
+        static const int32_t PULSE_WIDTH_MODULATION_RANGE_ = 45;
 
         uint8_t midiNoteIndex_;
         static const uint8_t MIDI_NOTE_COUNT_ = 128;
         static const uint8_t NO_MIDI_NOTE_ = 0;
-        float noteFrequencyTable_[MIDI_NOTE_COUNT_];
 
-        uint32_t sampleCount_;
+        // The filter, effects and output stage work on signed float samples, so each control block is
+        // converted into this before processing and back into the unsigned DAC format afterward.
+        // The oscillators' mix swings around mixCenter_, which becomes zero in the float samples and
+        // the DAC midpoint again afterward, so a held note is centered where silence is.
+        float outputBlock_[CONTROL_BLOCK_SIZE];
+        float mixCenter_;
+        static const int32_t DAC_MIDPOINT_ = 32768;
+        static const int32_t DAC_MAX_ = 65535;
+
+        // Silence is the DAC midpoint on every path.  When the output drops to it from a note (or a
+        // tail that's cut off) it ramps there by at most this much a sample, rather than jumping,
+        // which takes at most 256 samples (6 ms).
+        uint16_t lastOutput_;
+        static const int32_t SILENCE_RAMP_STEP_ = 128;
+
+        // Dither state: the noise generator (a xorshift32) and the last rounding error, which is fed
+        // back into the next sample to push the rounding noise up toward Nyquist.
+        uint32_t ditherState_;
+        float ditherError_;
+        static const uint32_t DITHER_SEED_ = 22222u;
 };
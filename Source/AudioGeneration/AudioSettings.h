@@ -0,0 +1,56 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// The rate at which samples are fed to the DAC (see AudioOutput).
+const float SAMPLE_RATE = 44100.0f;
+
+// Anything that doesn't need to change every sample (filter coefficients and the like) is
+// recalculated once per control block rather than once per sample.
+const uint32_t CONTROL_BLOCK_SIZE = 32;
+
+// The delay based effects keep their audio in 16 bit delay lines whose sizes are powers of two
+// (see DelayLine).  They're part of the AudioMixer, which the firmware allocates statically in the
+// TM4C123's 32 KB of SRAM alongside a 4 KB stack and a 4 KB heap, so the firmware gets a shorter
+// delay than host builds.
+#ifdef PART_TM4C123GH6PM
+const uint32_t DELAY_BUFFER_SIZE = 4096;   // 8 KB, 92 ms
+#else
+const uint32_t DELAY_BUFFER_SIZE = 8192;   // 16 KB, 185 ms
+#endif
+const uint32_t CHORUS_BUFFER_SIZE = 1024;  // 2 KB, 23 ms
+
+// The reverb's comb and allpass delays are Freeverb's, divided by this (see Reverb).  At full size
+// they take 25 KB, which only host builds can spare.  A quarter of the size (6 KB) is a smaller,
+// brighter room.
+#ifdef PART_TM4C123GH6PM
+const uint32_t REVERB_TANK_DIVISOR = 4;
+#else
+const uint32_t REVERB_TANK_DIVISOR = 1;
+#endif
@@ -0,0 +1,178 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/Chorus.h"
+
+const float samplesPerMillisecond = SAMPLE_RATE / 1000.0f;
+
+// The delay each tap sweeps around and how far it sweeps (at full depth) either side of it
+const float chorusCenterDelay = 12.0f * samplesPerMillisecond;
+const float chorusSweep = 6.0f * samplesPerMillisecond;
+const float flangerCenterDelay = 3.5f * samplesPerMillisecond;
+const float flangerSweep = 3.0f * samplesPerMillisecond;
+const float flangerFeedback = 0.6f;
+
+// Starts at zero and rises, same as LFO's triangle
+float ChorusLFO(float phase)
+{
+    return (phase < 0.25f) ? (4.0f * phase) :
+           (phase < 0.75f) ? (2.0f - 4.0f * phase) :
+                             (4.0f * phase - 4.0f);
+}
+
+Chorus::Chorus() :
+    mode_(OFF),
+    rate_(8),
+    depth_(50),
+    phase_(0.0f),
+    delayA_(chorusCenterDelay),
+    delayB_(chorusCenterDelay),
+    delayStepA_(0.0f),
+    delayStepB_(0.0f),
+    feedback_(0.0f) { }
+
+Chorus::Mode Chorus::GetMode()
+{
+    return mode_;
+}
+
+uint8_t Chorus::GetRate()
+{
+    return rate_;
+}
+
+uint8_t Chorus::GetDepth()
+{
+    return depth_;
+}
+
+void Chorus::SetMode(Mode mode)
+{
+    // Whatever was left in the line from the last time the effect was on shouldn't come back
+    if(mode_ == OFF && mode != OFF)
+    {
+        delayLine_.Clear();
+    }
+
+    mode_ = mode;
+}
+
+void Chorus::SetRate(uint8_t rate)
+{
+    if(rate < MIN_RATE) { rate_ = MIN_RATE; }
+    else if(rate > MAX_RATE) { rate_ = MAX_RATE; }
+    else { rate_ = rate; }
+}
+
+void Chorus::SetDepth(uint8_t depth)
+{
+    if(depth > MAX_DEPTH) { depth_ = MAX_DEPTH; }
+    else { depth_ = depth; }
+}
+
+void Chorus::StartBlock(uint32_t bufferSampleSize)
+{
+    float centerDelay = chorusCenterDelay;
+    float sweep = chorusSweep;
+    feedback_ = 0.0f;
+
+    if(mode_ == FLANGER)
+    {
+        centerDelay = flangerCenterDelay;
+        sweep = flangerSweep;
+        feedback_ = flangerFeedback;
+    }
+
+    sweep *= static_cast<float>(depth_) / MAX_DEPTH;
+
+    phase_ += static_cast<float>(bufferSampleSize) * (static_cast<float>(rate_) / 10.0f) / SAMPLE_RATE;
+    if(phase_ >= 1.0f)
+    {
+        phase_ -= 1.0f;
+    }
+
+    // The taps sweep in opposite directions
+    float oppositePhase = (phase_ < 0.5f) ? (phase_ + 0.5f) : (phase_ - 0.5f);
+    float endDelayA = centerDelay + sweep * ChorusLFO(phase_);
+    float endDelayB = centerDelay + sweep * ChorusLFO(oppositePhase);
+
+    // The delays ramp from wherever the last block left them, so changing the mode or depth
+    // sweeps the taps over rather than jumping them
+    delayStepA_ = (endDelayA - delayA_) / static_cast<float>(bufferSampleSize);
+    delayStepB_ = (endDelayB - delayB_) / static_cast<float>(bufferSampleSize);
+}
+
+void Chorus::Process(float buffer[], uint32_t bufferSampleSize)
+{
+    StartBlock(bufferSampleSize);
+
+    const float feedback = feedback_;
+    float delayA = delayA_;
+    float delayB = delayB_;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        delayA += delayStepA_;
+        delayB += delayStepB_;
+
+        float input = buffer[i];
+        float tapSum = delayLine_.Read(delayA) + delayLine_.Read(delayB);
+        delayLine_.Write(input + feedback * 0.5f * tapSum);
+
+        // Half dry and half wet, so low frequencies (where the taps line up with the input) come
+        // out at the level they went in
+        buffer[i] = 0.5f * input + 0.25f * tapSum;
+    }
+
+    delayA_ = delayA;
+    delayB_ = delayB;
+}
+
+void Chorus::ProcessStereo(const float input[], float left[], float right[], uint32_t bufferSampleSize)
+{
+    StartBlock(bufferSampleSize);
+
+    const float feedback = feedback_;
+    float delayA = delayA_;
+    float delayB = delayB_;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        delayA += delayStepA_;
+        delayB += delayStepB_;
+
+        float dry = input[i];
+        float tapA = delayLine_.Read(delayA);
+        float tapB = delayLine_.Read(delayB);
+        delayLine_.Write(dry + feedback * 0.5f * (tapA + tapB));
+
+        left[i] = 0.5f * (dry + tapA);
+        right[i] = 0.5f * (dry + tapB);
+    }
+
+    delayA_ = delayA;
+    delayB_ = delayB;
+}
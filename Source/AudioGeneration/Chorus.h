@@ -0,0 +1,82 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "AudioGeneration/AudioSettings.h"
+#include "AudioGeneration/DelayLine.h"
+
+// A chorus/flanger with two taps into one delay line, swept by a triangle LFO in opposite
+// directions (like the Juno's chorus).  Process sums the taps for the mono DAC, while
+// ProcessStereo gives each side its own tap.  The flanger uses shorter delays and feeds the taps
+// back into the line.  Samples are signed and in DAC units.
+class Chorus
+{
+    public:
+        enum Mode
+        {
+            OFF,
+            CHORUS,
+            FLANGER
+        };
+
+        // The rate is in tenths of a Hz and the depth is a percentage of the full sweep
+        static const uint8_t MIN_RATE = 1;
+        static const uint8_t MAX_RATE = 50;
+        static const uint8_t MAX_DEPTH = 100;
+
+        Chorus();
+
+        Mode GetMode();
+        uint8_t GetRate();
+        uint8_t GetDepth();
+
+        void SetMode(Mode mode);
+        void SetRate(uint8_t rate);
+        void SetDepth(uint8_t depth);
+
+        void Process(float buffer[], uint32_t bufferSampleSize);
+        void ProcessStereo(const float input[], float left[], float right[], uint32_t bufferSampleSize);
+
+    private:
+        // Works out where each tap's delay moves to over the block and advances the LFO
+        void StartBlock(uint32_t bufferSampleSize);
+
+        Mode mode_;
+        uint8_t rate_;
+        uint8_t depth_;
+
+        DelayLine<CHORUS_BUFFER_SIZE> delayLine_;
+        float phase_;  // 0.0 to 1.0
+
+        // Each tap's delay (in samples) at the start of the block and how much it changes per sample
+        float delayA_;
+        float delayB_;
+        float delayStepA_;
+        float delayStepB_;
+        float feedback_;
+};
@@ -0,0 +1,108 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/Delay.h"
+
+const float samplesPerTimeStep = SAMPLE_RATE / 100.0f;
+
+// Each block the delay moves this fraction of the way toward the time setting (so a change takes
+// about 50 ms)
+const float delayGlide = 0.03f;
+
+Delay::Delay() :
+    time_(0),
+    feedback_(40),
+    mix_(50),
+    delay_(0.0f) { }
+
+uint8_t Delay::GetTime()
+{
+    return time_;
+}
+
+uint8_t Delay::GetFeedback()
+{
+    return feedback_;
+}
+
+uint8_t Delay::GetMix()
+{
+    return mix_;
+}
+
+void Delay::SetTime(uint8_t time)
+{
+    if(time > MAX_TIME) { time = MAX_TIME; }
+
+    // Whatever was left in the line from the last time the delay was on shouldn't come back, and
+    // the first echoes should come at the new time rather than glide to it
+    if(time_ == 0 && time != 0)
+    {
+        delayLine_.Clear();
+        delay_ = static_cast<float>(time) * samplesPerTimeStep;
+    }
+
+    time_ = time;
+}
+
+void Delay::SetFeedback(uint8_t feedback)
+{
+    if(feedback > MAX_FEEDBACK) { feedback_ = MAX_FEEDBACK; }
+    else { feedback_ = feedback; }
+}
+
+void Delay::SetMix(uint8_t mix)
+{
+    if(mix > MAX_MIX) { mix_ = MAX_MIX; }
+    else { mix_ = mix; }
+}
+
+void Delay::Process(float buffer[], uint32_t bufferSampleSize)
+{
+    float targetDelay = static_cast<float>(time_) * samplesPerTimeStep;
+    float endDelay = delay_ + (targetDelay - delay_) * delayGlide;
+    if(endDelay - targetDelay < 1.0f && targetDelay - endDelay < 1.0f)
+    {
+        endDelay = targetDelay;
+    }
+
+    const float delayStep = (endDelay - delay_) / static_cast<float>(bufferSampleSize);
+    const float feedback = static_cast<float>(feedback_) / 100.0f;
+    const float mix = static_cast<float>(mix_) / 100.0f;
+    float delay = delay_;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        delay += delayStep;
+
+        float input = buffer[i];
+        float echo = delayLine_.Read(delay);
+        delayLine_.Write(input + feedback * echo);
+        buffer[i] = input + mix * echo;
+    }
+
+    delay_ = endDelay;
+}
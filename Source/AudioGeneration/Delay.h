@@ -0,0 +1,64 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "AudioGeneration/AudioSettings.h"
+#include "AudioGeneration/DelayLine.h"
+
+// A feedback delay (echo).  Changing the time glides the read position over to the new time
+// rather than jumping it, which bends the pitch of the echoes like a tape delay instead of
+// clicking.  Samples are signed and in DAC units.
+class Delay
+{
+    public:
+        // The time is in 10 ms steps (zero turns the delay off) and the feedback and mix are
+        // percentages
+        static const uint8_t MAX_TIME = (DELAY_BUFFER_SIZE - 1) / 441;
+        static const uint8_t MAX_FEEDBACK = 90;
+        static const uint8_t MAX_MIX = 100;
+
+        Delay();
+
+        uint8_t GetTime();
+        uint8_t GetFeedback();
+        uint8_t GetMix();
+
+        void SetTime(uint8_t time);
+        void SetFeedback(uint8_t feedback);
+        void SetMix(uint8_t mix);
+
+        void Process(float buffer[], uint32_t bufferSampleSize);
+
+    private:
+        uint8_t time_;
+        uint8_t feedback_;
+        uint8_t mix_;
+
+        DelayLine<DELAY_BUFFER_SIZE> delayLine_;
+        float delay_;  // The current delay in samples, which moves toward the time setting
+};
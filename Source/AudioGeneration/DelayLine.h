@@ -0,0 +1,103 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// A circular buffer of 16 bit samples for the delay based effects.  The size has to be a power of
+// two so that wrapping an index around is a single mask, and the buffer is a plain member so it
+// takes up exactly size * 2 bytes wherever its owner is allocated.  Samples are floats in DAC
+// units (i.e. full scale is +/-32767) and are clamped to 16 bits as they're stored.
+template <uint32_t size>
+class DelayLine
+{
+    public:
+        DelayLine();
+
+        void Clear();
+
+        // Returns the sample written delay samples ago (1.0 being the last one written), linearly
+        // interpolating between neighbouring samples for fractional delays.  The delay has to be
+        // between 1.0 and GetMaxDelay().
+        float Read(float delay);
+        void Write(float sample);
+
+        uint32_t GetMaxDelay();
+
+    private:
+        // A negative array size fails the compile if size isn't a power of two
+        typedef char SizeMustBeAPowerOfTwo[((size & (size - 1)) == 0) ? 1 : -1];
+
+        static const uint32_t MASK_ = size - 1;
+
+        int16_t buffer_[size];
+        uint32_t writeIndex_;
+};
+
+template <uint32_t size>
+DelayLine<size>::DelayLine() : writeIndex_(0)
+{
+    Clear();
+}
+
+template <uint32_t size>
+void DelayLine<size>::Clear()
+{
+    for(uint32_t i = 0; i < size; ++i)
+    {
+        buffer_[i] = 0;
+    }
+}
+
+template <uint32_t size>
+inline float DelayLine<size>::Read(float delay)
+{
+    uint32_t wholeDelay = static_cast<uint32_t>(delay);
+    float fraction = delay - static_cast<float>(wholeDelay);
+
+    float newer = static_cast<float>(buffer_[(writeIndex_ - wholeDelay) & MASK_]);
+    float older = static_cast<float>(buffer_[(writeIndex_ - wholeDelay - 1) & MASK_]);
+
+    return newer + fraction * (older - newer);
+}
+
+template <uint32_t size>
+inline void DelayLine<size>::Write(float sample)
+{
+    int32_t value = static_cast<int32_t>(sample);
+    if(value > 32767) { value = 32767; }
+    else if(value < -32767) { value = -32767; }
+
+    buffer_[writeIndex_] = static_cast<int16_t>(value);
+    writeIndex_ = (writeIndex_ + 1) & MASK_;
+}
+
+template <uint32_t size>
+uint32_t DelayLine<size>::GetMaxDelay()
+{
+    return size - 1;
+}
@@ -0,0 +1,77 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/FilterCutoffTable.h"
+#include "AudioGeneration/NoteFrequencyTable.h"
+#include "AudioGeneration/AudioSettings.h"
+#include <math.h>
+
+// The filter cutoff uses the same 0-to-127 range as the MIDI notes, so a cutoff value maps to the
+// frequency of the note with the same index.  The state variable filter doesn't want the frequency
+// itself though, it wants tan(pi * frequency / sampleRate).  Calculating tanf on the M4F isn't cheap,
+// so the values are calculated once up front and linearly interpolated for fractional cutoffs.
+const int cutoffCount = 128;
+const float pi = 3.14159265f;
+
+// tan() heads off to infinity as the frequency approaches Nyquist, so the cutoff frequency is
+// clamped a little below it.
+const float maxCutoffFrequency = SAMPLE_RATE * 0.45f;
+
+float filterCutoffTable_[cutoffCount];
+
+void InitializeFilterCutoffTable()
+{
+    volatile int i = 0;
+
+    for(; i < cutoffCount; ++i)
+    {
+        float frequency = GetFrequency(static_cast<uint8_t>(i));
+        if(frequency > maxCutoffFrequency)
+        {
+            frequency = maxCutoffFrequency;
+        }
+
+        filterCutoffTable_[i] = tanf(pi * frequency / SAMPLE_RATE);
+    }
+}
+
+float GetFilterCutoffCoefficient(float cutoff)
+{
+    if(cutoff <= 0.0f)
+    {
+        return filterCutoffTable_[0];
+    }
+
+    if(cutoff >= static_cast<float>(cutoffCount - 1))
+    {
+        return filterCutoffTable_[cutoffCount - 1];
+    }
+
+    int index = static_cast<int>(cutoff);
+    float fraction = cutoff - static_cast<float>(index);
+
+    return filterCutoffTable_[index] + (filterCutoffTable_[index + 1] - filterCutoffTable_[index]) * fraction;
+}
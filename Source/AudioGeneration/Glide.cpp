@@ -0,0 +1,112 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/Glide.h"
+#include "AudioGeneration/AudioSettings.h"
+
+Glide::Glide() :
+    mode_(TIME),
+    time_(0),
+    legato_(true),
+    currentNote_(0.0f),
+    targetNote_(0.0f),
+    step_(0.0f) { }
+
+Glide::Mode Glide::GetMode()
+{
+    return mode_;
+}
+
+uint8_t Glide::GetTime()
+{
+    return time_;
+}
+
+bool Glide::GetLegato()
+{
+    return legato_;
+}
+
+void Glide::SetMode(Mode mode)
+{
+    mode_ = mode;
+}
+
+void Glide::SetTime(uint8_t time)
+{
+    if(time > MAX_TIME) { time_ = MAX_TIME; }
+    else { time_ = time; }
+}
+
+void Glide::SetLegato(bool legato)
+{
+    legato_ = legato;
+}
+
+void Glide::StartNote(uint8_t note, bool overlapping)
+{
+    targetNote_ = static_cast<float>(note);
+
+    // Jump straight to the note if there's nothing to glide from
+    if(time_ == 0 || currentNote_ == 0.0f || (legato_ && !overlapping))
+    {
+        currentNote_ = targetNote_;
+        step_ = 0.0f;
+        return;
+    }
+
+    float distance = targetNote_ - currentNote_;
+    if(distance < 0.0f)
+    {
+        distance = -distance;
+    }
+
+    float glideBlocks = static_cast<float>(time_) * TIME_STEP_MS * (SAMPLE_RATE / 1000.0f) / CONTROL_BLOCK_SIZE;
+    if(mode_ == TIME)
+    {
+        step_ = distance / glideBlocks;
+    }
+    else
+    {
+        step_ = 12.0f / glideBlocks;
+    }
+}
+
+float Glide::Tick()
+{
+    if(currentNote_ < targetNote_)
+    {
+        currentNote_ += step_;
+        if(currentNote_ > targetNote_) { currentNote_ = targetNote_; }
+    }
+    else if(currentNote_ > targetNote_)
+    {
+        currentNote_ -= step_;
+        if(currentNote_ < targetNote_) { currentNote_ = targetNote_; }
+    }
+
+    return currentNote_ - targetNote_;
+}
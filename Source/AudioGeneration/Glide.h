@@ -0,0 +1,73 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Portamento between notes.  The glide moves in semitones (i.e. in the log-frequency domain) so it
+// sounds even across the keyboard, and only runs at control rate: Tick is called once per control
+// block and returns how far (in semitones) the pitch being played is from the note being held.
+class Glide
+{
+    public:
+        enum Mode
+        {
+            TIME,  // Every glide takes the glide time
+            RATE   // Every octave of a glide takes the glide time
+        };
+
+        // The time is in 20 ms steps
+        static const uint8_t MAX_TIME = 100;
+        static const uint8_t TIME_STEP_MS = 20;
+
+        Glide();
+
+        Mode GetMode();
+        uint8_t GetTime();
+        bool GetLegato();
+
+        void SetMode(Mode mode);
+        void SetTime(uint8_t time);
+
+        // In legato mode (the default), only a note played while another is still held glides to
+        // its pitch.  Otherwise every new note glides from the last note played.
+        void SetLegato(bool legato);
+
+        // Called when a new note starts.  Overlapping is whether the previous note was still held.
+        void StartNote(uint8_t note, bool overlapping);
+
+        float Tick();
+
+    private:
+        Mode mode_;
+        uint8_t time_;
+        bool legato_;
+
+        float currentNote_;
+        float targetNote_;
+        float step_;  // Semitones per control block
+};
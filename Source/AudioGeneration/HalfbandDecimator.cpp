@@ -0,0 +1,75 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/HalfbandDecimator.h"
+
+// The non-zero taps either side of the center (at offsets 1, 3, 5 ... 15).  They're a Kaiser
+// windowed (beta = 7) sinc, scaled to sum to 0.25 so the filter has exactly unity gain at DC.
+const uint32_t halfbandTapCount = 8;
+const float halfbandTaps[halfbandTapCount] =
+{
+    0.314333444f, -0.094603225f, 0.046059050f, -0.023742550f,
+    0.011624843f, -0.005037465f, 0.001760300f, -0.000394397f
+};
+
+HalfbandDecimator::HalfbandDecimator()
+{
+    for(uint32_t i = 0; i < HISTORY_SIZE_; ++i)
+    {
+        buffer_[i] = 0.0f;
+    }
+}
+
+void HalfbandDecimator::Process(const float input[], float output[], uint32_t outputSampleSize)
+{
+    uint32_t inputSampleSize = 2 * outputSampleSize;
+
+    for(uint32_t i = 0; i < inputSampleSize; ++i)
+    {
+        buffer_[HISTORY_SIZE_ + i] = input[i];
+    }
+
+    // Only every other output of the full rate filter is needed, and for those the center tap
+    // always lands on an even sample while the non-zero taps all land on odd ones.
+    for(uint32_t i = 0; i < outputSampleSize; ++i)
+    {
+        const float* center = &(buffer_[2 * i + HALF_LENGTH_ + 1]);
+
+        float sum = 0.5f * center[0];
+        for(uint32_t tap = 0; tap < halfbandTapCount; ++tap)
+        {
+            uint32_t offset = 2 * tap + 1;
+            sum += halfbandTaps[tap] * (center[-static_cast<int32_t>(offset)] + center[offset]);
+        }
+
+        output[i] = sum;
+    }
+
+    for(uint32_t i = 0; i < HISTORY_SIZE_; ++i)
+    {
+        buffer_[i] = buffer_[inputSampleSize + i];
+    }
+}
@@ -0,0 +1,50 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "AudioGeneration/AudioSettings.h"
+
+// Brings audio rendered at twice the sample rate back down to it.  The low pass is a 31 tap
+// halfband FIR: every other tap (apart from the center one, which is 0.5) is zero, and the rest
+// are symmetric, so each output sample only costs 8 multiplies.  It passes up to 16 kHz within
+// 0.01 dB and attenuates everything that would alias back below 16 kHz by over 65 dB.
+class HalfbandDecimator
+{
+    public:
+        HalfbandDecimator();
+
+        // The input holds twice outputSampleSize samples (up to two control blocks' worth)
+        void Process(const float input[], float output[], uint32_t outputSampleSize);
+
+    private:
+        static const uint32_t HALF_LENGTH_ = 15;  // Taps either side of the center
+        static const uint32_t HISTORY_SIZE_ = 2 * HALF_LENGTH_;
+
+        // The last HISTORY_SIZE_ input samples followed by the block being decimated
+        float buffer_[HISTORY_SIZE_ + 2 * CONTROL_BLOCK_SIZE];
+};
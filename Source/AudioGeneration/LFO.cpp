@@ -0,0 +1,105 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/LFO.h"
+#include "AudioGeneration/AudioSettings.h"
+
+LFO::LFO() :
+    shape_(TRIANGLE),
+    rate_(20),
+    phase_(0.0f),
+    heldValue_(0.0f),
+    randomState_(0x12345678) { }
+
+LFO::Shape LFO::GetShape()
+{
+    return shape_;
+}
+
+uint8_t LFO::GetRate()
+{
+    return rate_;
+}
+
+void LFO::SetShape(Shape shape)
+{
+    shape_ = shape;
+}
+
+void LFO::SetRate(uint8_t rate)
+{
+    if(rate < MIN_RATE) { rate_ = MIN_RATE; }
+    else if(rate > MAX_RATE) { rate_ = MAX_RATE; }
+    else { rate_ = rate; }
+}
+
+float LFO::Tick()
+{
+    float value = 0.0f;
+
+    if(shape_ == TRIANGLE)
+    {
+        // Starts at zero and rises, same as a sine would
+        value = (phase_ < 0.25f) ? (4.0f * phase_) :
+                (phase_ < 0.75f) ? (2.0f - 4.0f * phase_) :
+                                   (4.0f * phase_ - 4.0f);
+    }
+    else if(shape_ == SQUARE)
+    {
+        value = (phase_ < 0.5f) ? 1.0f : -1.0f;
+    }
+    else if(shape_ == SAMPLE_AND_HOLD)
+    {
+        value = heldValue_;
+    }
+
+    const float controlRate = SAMPLE_RATE / static_cast<float>(CONTROL_BLOCK_SIZE);
+    phase_ += (static_cast<float>(rate_) / 10.0f) / controlRate;
+    if(phase_ >= 1.0f)
+    {
+        phase_ -= 1.0f;
+
+        // Pick a new value at the start of each cycle.  The top 16 bits of the generator are
+        // scaled to -1.0 to 1.0.
+        heldValue_ = static_cast<float>(static_cast<int32_t>(NextRandomValue() >> 16) - 32768) / 32768.0f;
+    }
+
+    return value;
+}
+
+void LFO::Reset()
+{
+    phase_ = 0.0f;
+}
+
+uint32_t LFO::NextRandomValue()
+{
+    // Marsaglia's xorshift32
+    randomState_ ^= randomState_ << 13;
+    randomState_ ^= randomState_ >> 17;
+    randomState_ ^= randomState_ << 5;
+    return randomState_;
+}
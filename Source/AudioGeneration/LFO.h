@@ -0,0 +1,67 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// A low frequency oscillator for modulation.  LFOs only run at control rate, so Tick should be
+// called once per control block and returns the LFO's value (-1.0 to 1.0) for that block.
+class LFO
+{
+    public:
+        enum Shape
+        {
+            TRIANGLE,
+            SQUARE,
+            SAMPLE_AND_HOLD
+        };
+
+        // The rate is in tenths of a Hz
+        static const uint8_t MIN_RATE = 1;
+        static const uint8_t MAX_RATE = 200;
+
+        LFO();
+
+        Shape GetShape();
+        uint8_t GetRate();
+
+        void SetShape(Shape shape);
+        void SetRate(uint8_t rate);
+
+        float Tick();
+        void Reset();
+
+    private:
+        uint32_t NextRandomValue();
+
+        Shape shape_;
+        uint8_t rate_;
+
+        float phase_;  // 0.0 to 1.0
+        float heldValue_;
+        uint32_t randomState_;
+};
@@ -0,0 +1,110 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/ModulationMatrix.h"
+
+ModulationMatrix::ModulationMatrix()
+{
+    for(uint8_t i = 0; i < SLOT_COUNT; ++i)
+    {
+        slots_[i].source_ = NO_SOURCE;
+        slots_[i].destination_ = NO_DESTINATION;
+        slots_[i].amount_ = 0;
+    }
+
+    for(uint8_t i = 0; i < DESTINATION_COUNT; ++i)
+    {
+        modulation_[i] = 0.0f;
+    }
+}
+
+ModulationMatrix::Source ModulationMatrix::GetSource(uint8_t slot)
+{
+    return (slot < SLOT_COUNT) ? slots_[slot].source_ : NO_SOURCE;
+}
+
+ModulationMatrix::Destination ModulationMatrix::GetDestination(uint8_t slot)
+{
+    return (slot < SLOT_COUNT) ? slots_[slot].destination_ : NO_DESTINATION;
+}
+
+int8_t ModulationMatrix::GetAmount(uint8_t slot)
+{
+    return (slot < SLOT_COUNT) ? slots_[slot].amount_ : 0;
+}
+
+void ModulationMatrix::SetSource(uint8_t slot, Source source)
+{
+    if(slot < SLOT_COUNT && source < SOURCE_COUNT)
+    {
+        slots_[slot].source_ = source;
+    }
+}
+
+void ModulationMatrix::SetDestination(uint8_t slot, Destination destination)
+{
+    if(slot < SLOT_COUNT && destination < DESTINATION_COUNT)
+    {
+        slots_[slot].destination_ = destination;
+    }
+}
+
+void ModulationMatrix::SetAmount(uint8_t slot, int8_t amount)
+{
+    if(slot >= SLOT_COUNT)
+    {
+        return;
+    }
+
+    if(amount < MIN_AMOUNT) { amount = MIN_AMOUNT; }
+    else if(amount > MAX_AMOUNT) { amount = MAX_AMOUNT; }
+
+    slots_[slot].amount_ = amount;
+}
+
+void ModulationMatrix::Evaluate(const float sourceValues[SOURCE_COUNT])
+{
+    for(uint8_t i = 0; i < DESTINATION_COUNT; ++i)
+    {
+        modulation_[i] = 0.0f;
+    }
+
+    for(uint8_t i = 0; i < SLOT_COUNT; ++i)
+    {
+        const Slot& slot = slots_[i];
+        if(slot.source_ == NO_SOURCE || slot.destination_ == NO_DESTINATION || slot.amount_ == 0)
+        {
+            continue;
+        }
+
+        modulation_[slot.destination_] += sourceValues[slot.source_] * (static_cast<float>(slot.amount_) / 100.0f);
+    }
+}
+
+float ModulationMatrix::GetModulation(Destination destination)
+{
+    return (destination < DESTINATION_COUNT) ? modulation_[destination] : 0.0f;
+}
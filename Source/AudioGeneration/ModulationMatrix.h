@@ -0,0 +1,86 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// A small, fixed size modulation matrix.  Each slot routes a source (e.g. an LFO) to a destination
+// (e.g. pitch) with an amount of -100% to +100%.  Evaluate is called once per control block, so the
+// cost of modulation doesn't depend on how many samples there are in a block.
+class ModulationMatrix
+{
+    public:
+        enum Source
+        {
+            NO_SOURCE,
+            LFO_1,
+            LFO_2,
+            SOURCE_COUNT
+        };
+
+        enum Destination
+        {
+            NO_DESTINATION,
+            PITCH,
+            LEVEL,
+            FILTER_CUTOFF,
+            PULSE_WIDTH,
+            DESTINATION_COUNT
+        };
+
+        static const uint8_t SLOT_COUNT = 8;
+        static const int8_t MIN_AMOUNT = -100;
+        static const int8_t MAX_AMOUNT = 100;
+
+        ModulationMatrix();
+
+        Source GetSource(uint8_t slot);
+        Destination GetDestination(uint8_t slot);
+        int8_t GetAmount(uint8_t slot);
+
+        void SetSource(uint8_t slot, Source source);
+        void SetDestination(uint8_t slot, Destination destination);
+        void SetAmount(uint8_t slot, int8_t amount);
+
+        // The source values are expected to be -1.0 to 1.0 (NO_SOURCE is ignored).
+        void Evaluate(const float sourceValues[SOURCE_COUNT]);
+
+        // Returns the sum of everything routed to the destination during the last Evaluate.  A
+        // single slot with a full amount gives -1.0 to 1.0.
+        float GetModulation(Destination destination);
+
+    private:
+        struct Slot
+        {
+            Source source_;
+            Destination destination_;
+            int8_t amount_;
+        };
+
+        Slot slots_[SLOT_COUNT];
+        float modulation_[DESTINATION_COUNT];
+};
@@ -25,21 +25,86 @@
  */
 
 #include "AudioGeneration/Oscillator.h"
-#include "AudioGeneration/NoteFrequencyTable.h"
+#include "AudioGeneration/AudioSettings.h"
+#include "AudioGeneration/PitchRatioTable.h"
+#include "AudioGeneration/Samples/KeysSample.h"
 #include <math.h>
 
+// Each block moves the level this fraction of the way to where it's headed, which takes about ten
+// blocks (7 ms) to get there.  Once within one DAC step it just jumps the rest of the way.
+const float levelSmoothing = 0.25f;
+
 // The default constructor just sets up default values for the oscillator
 Oscillator::Oscillator() :
     waveformType_(Square),
     level_(10),
     cent_(0),
-    semitone_(0) { }
+    semitone_(0),
+    centRatio_(1.0f),
+    pulseWidth_(50),
+    bandLimited_(false),
+    cyclePosition_(0.0f),
+    tunedNoteIndex_(0),
+    tuningChanged_(true),
+    tuningChangeCount_(0),
+    tunedSamplesPerCycle_(0.0f),
+    snapLevel_(true),
+    samplesPerCycle_(0.0f),
+    phaseIncrement_(0.0f),
+    peakLevel_(0.0f),
+    halfPeakLevel_(0.0f),
+    pulseStart_(0.5f),
+    modulatorOutput_(0.0f),
+    cycleRestarted_(false),
+    noiseState_(NOISE_SEED_),
+    sample_(&keysSample),
+    samplePosition_(0.0f),
+    sampleIncrement_(0.0f),
+    unisonCount_(1),
+    unisonSpread_(15),
+    renderUnison_(false),
+    unisonMaxPhaseIncrement_(1.0f)
+{
+    pinkNoiseFilter_[0] = pinkNoiseFilter_[1] = pinkNoiseFilter_[2] = 0.0f;
+    InitializeUnisonVoices();
+}
 
-Oscillator::Oscillator(enum WaveformType waveformType, uint8_t level, int8_t cent, int8_t semitone) :
+Oscillator::Oscillator(enum WaveformType waveformType, uint8_t level, int16_t cent, int8_t semitone) :
     waveformType_(waveformType),
     level_(level),
-    cent_(cent),
-    semitone_(semitone) { }
+    cent_(0),
+    semitone_(semitone),
+    centRatio_(1.0f),
+    pulseWidth_(50),
+    bandLimited_(false),
+    cyclePosition_(0.0f),
+    tunedNoteIndex_(0),
+    tuningChanged_(true),
+    tuningChangeCount_(0),
+    tunedSamplesPerCycle_(0.0f),
+    snapLevel_(true),
+    samplesPerCycle_(0.0f),
+    phaseIncrement_(0.0f),
+    peakLevel_(0.0f),
+    halfPeakLevel_(0.0f),
+    pulseStart_(0.5f),
+    modulatorOutput_(0.0f),
+    cycleRestarted_(false),
+    noiseState_(NOISE_SEED_),
+    sample_(&keysSample),
+    samplePosition_(0.0f),
+    sampleIncrement_(0.0f),
+    unisonCount_(1),
+    unisonSpread_(15),
+    renderUnison_(false),
+    unisonMaxPhaseIncrement_(1.0f)
+{
+    pinkNoiseFilter_[0] = pinkNoiseFilter_[1] = pinkNoiseFilter_[2] = 0.0f;
+    InitializeUnisonVoices();
+
+    // Clamped to the cent range the same way as when it's set later
+    SetCent(cent);
+}
 
 WaveformType Oscillator::GetWaveformType()
 {
@@ -51,7 +116,7 @@ uint8_t Oscillator::GetLevel()
     return level_;
 }
 
-int8_t Oscillator::GetCent()
+int16_t Oscillator::GetCent()
 {
     return cent_;
 }
@@ -61,6 +126,31 @@ int8_t Oscillator::GetSemitone()
     return semitone_;
 }
 
+uint8_t Oscillator::GetPulseWidth()
+{
+    return pulseWidth_;
+}
+
+bool Oscillator::GetBandLimited()
+{
+    return bandLimited_;
+}
+
+uint8_t Oscillator::GetUnisonCount()
+{
+    return unisonCount_;
+}
+
+uint8_t Oscillator::GetUnisonSpread()
+{
+    return unisonSpread_;
+}
+
+const SampleData* Oscillator::GetSample()
+{
+    return sample_;
+}
+
 void Oscillator::SetWaveformType(WaveformType waveformType)
 {
     waveformType_ = waveformType;
@@ -71,67 +161,433 @@ void Oscillator::SetLevel(uint8_t level)
     level_ = level;
 }
 
-void Oscillator::SetCent(int8_t cent)
+void Oscillator::SetCent(int16_t cent)
 {
-    cent_ = cent;
+    if(cent < MIN_CENT) { cent_ = MIN_CENT; }
+    else if(cent > MAX_CENT) { cent_ = MAX_CENT; }
+    else { cent_ = cent; }
+
+    centRatio_ = GetCentRatio(static_cast<float>(-cent_));
+    tuningChanged_ = true;
 }
 
 void Oscillator::SetSemitone(int8_t semitone)
 {
     semitone_ = semitone;
+    tuningChanged_ = true;
+}
+
+void Oscillator::SetPulseWidth(uint8_t pulseWidth)
+{
+    if(pulseWidth < MIN_PULSE_WIDTH)
+    {
+        pulseWidth = MIN_PULSE_WIDTH;
+    }
+    else if(pulseWidth > MAX_PULSE_WIDTH)
+    {
+        pulseWidth = MAX_PULSE_WIDTH;
+    }
+
+    pulseWidth_ = pulseWidth;
+}
+
+void Oscillator::SetBandLimited(bool bandLimited)
+{
+    bandLimited_ = bandLimited;
+}
+
+void Oscillator::SetUnisonCount(uint8_t unisonCount)
+{
+    if(unisonCount < 1)
+    {
+        unisonCount = 1;
+    }
+    else if(unisonCount > MAX_UNISON_COUNT)
+    {
+        unisonCount = MAX_UNISON_COUNT;
+    }
+
+    unisonCount_ = unisonCount;
+    UpdateUnisonVoices();
+}
+
+void Oscillator::SetUnisonSpread(uint8_t unisonSpread)
+{
+    if(unisonSpread > MAX_UNISON_SPREAD)
+    {
+        unisonSpread = MAX_UNISON_SPREAD;
+    }
+
+    unisonSpread_ = unisonSpread;
+    UpdateUnisonVoices();
 }
 
-void Oscillator::MixInOscillatorAudio(uint16_t buffer[], uint32_t bufferSampleSize, uint8_t totalOscillatorCount, uint8_t noteIndex, uint32_t currentSample)
+void Oscillator::SetSample(const SampleData* sample)
+{
+    sample_ = sample;
+    samplePosition_ = 0.0f;
+}
+
+void Oscillator::InitializeUnisonVoices()
+{
+    // Start the unison voices spread out through the cycle so they don't all begin in step
+    for(uint8_t voice = 0; voice < MAX_UNISON_COUNT; ++voice)
+    {
+        float phase = voice * 0.618034f;
+        unisonPhase_[voice] = phase - floorf(phase);
+        unisonPhaseIncrement_[voice] = 0.0f;
+    }
+
+    UpdateUnisonVoices();
+}
+
+void Oscillator::UpdateUnisonVoices()
+{
+    unisonLaneVoiceCount_ = (unisonCount_ + UNISON_LANE_COUNT_ - 1) / UNISON_LANE_COUNT_ * UNISON_LANE_COUNT_;
+    unisonGain_ = 1.0f / static_cast<float>(unisonCount_);
+
+    for(uint8_t voice = 0; voice < MAX_UNISON_COUNT; ++voice)
+    {
+        if(voice < unisonCount_ && unisonCount_ > 1)
+        {
+            float cents = unisonSpread_ * (2.0f * voice / (unisonCount_ - 1) - 1.0f);
+            unisonDetune_[voice] = powf(2.0f, cents / 1200.0f);
+            unisonWeight_[voice] = 1.0f;
+        }
+        else
+        {
+            unisonDetune_[voice] = 1.0f;
+            unisonWeight_[voice] = (voice < unisonCount_) ? 1.0f : 0.0f;
+        }
+    }
+}
+
+float Oscillator::GetCenterLevel()
+{
+    return (waveformType_ == None) ? 0.0f : halfPeakLevel_;
+}
+
+void Oscillator::StartBlock(uint8_t totalOscillatorCount, uint8_t noteIndex, Tuning& tuning, float pitchModulation, float levelModulation,
+                            float pulseWidthModulation)
 {
     float samplesForOneCycle;
-    float cyclePercent;
-    float peakLevel;
-    volatile uint32_t i = 0;
+    float pulseWidth;
+
+    if(waveformType_ == None)
+    {
+        return;
+    }
+
+    float level = 0xFFFF * ((float)level_ / 10.0f) / (float)totalOscillatorCount * levelModulation;
+    float levelChange = level - peakLevel_;
+    if(snapLevel_ || (levelChange < 1.0f && levelChange > -1.0f))
+    {
+        peakLevel_ = level;
+        snapLevel_ = false;
+    }
+    else
+    {
+        peakLevel_ += levelChange * levelSmoothing;
+    }
+    halfPeakLevel_ = peakLevel_ * 0.5f;
+
+    if(tuningChanged_ || noteIndex != tunedNoteIndex_ || tuning.GetChangeCount() != tuningChangeCount_)
+    {
+        UpdateTuning(noteIndex, tuning);
+    }
+    samplesForOneCycle = tunedSamplesPerCycle_ / pitchModulation;
+
+    // If the pitch changed since the last block, scale our position so we're the same percentage
+    // of the way through the (new) cycle.
+    if(samplesForOneCycle != samplesPerCycle_)
+    {
+        if(samplesPerCycle_ > 0.0f)
+        {
+            cyclePosition_ = cyclePosition_ * (samplesForOneCycle / samplesPerCycle_);
+        }
+
+        // Written as !(<) so a NaN position is reset as well
+        if(!(cyclePosition_ < samplesForOneCycle))
+        {
+            cyclePosition_ = 0.0f;
+        }
+
+        samplesPerCycle_ = samplesForOneCycle;
+        phaseIncrement_ = 1.0f / samplesForOneCycle;
+    }
+
+    // The Square waveform starts each cycle low and goes high for the last pulseWidth of it
+    pulseWidth = static_cast<float>(pulseWidth_) / 100.0f + pulseWidthModulation;
+    if(pulseWidth < MIN_PULSE_WIDTH / 100.0f)
+    {
+        pulseWidth = MIN_PULSE_WIDTH / 100.0f;
+    }
+    else if(pulseWidth > MAX_PULSE_WIDTH / 100.0f)
+    {
+        pulseWidth = MAX_PULSE_WIDTH / 100.0f;
+    }
+    pulseStart_ = 1.0f - pulseWidth;
+
+    // The sample plays at its own rate for its root frequency, and proportionally faster or slower
+    // for other notes
+    if(waveformType_ == Sample)
+    {
+        sampleIncrement_ = sample_->sampleRate / (samplesForOneCycle * sample_->rootFrequency);
+    }
+
+    // Detuned copies of noise would just be more noise
+    renderUnison_ = (unisonCount_ > 1) && (waveformType_ == Square || waveformType_ == Sawtooth);
+    if(renderUnison_)
+    {
+        unisonMaxPhaseIncrement_ = 0.0f;
+        for(uint8_t voice = 0; voice < unisonLaneVoiceCount_; ++voice)
+        {
+            unisonPhaseIncrement_[voice] = phaseIncrement_ * unisonDetune_[voice];
+            if(unisonPhaseIncrement_[voice] > unisonMaxPhaseIncrement_)
+            {
+                unisonMaxPhaseIncrement_ = unisonPhaseIncrement_[voice];
+            }
+        }
+    }
+}
 
+void Oscillator::MixInOscillatorAudio(uint16_t buffer[], uint32_t bufferSampleSize)
+{
     if(waveformType_ == None)
     {
         return;
     }
 
-    peakLevel = 0xFFFF * ((float)level_ / 10.0f) / (float)totalOscillatorCount;
-    samplesForOneCycle = GetSamplesPerCycle(noteIndex);
+    if(renderUnison_)
+    {
+        float unisonLevel = peakLevel_ * unisonGain_;
+        for(uint32_t i = 0; i < bufferSampleSize; ++i)
+        {
+            buffer[i] += static_cast<uint16_t>(unisonLevel * SumUnisonVoices());
+            AdvanceUnisonVoices(1.0f);
+        }
+
+        return;
+    }
+
+    // Without band limiting, Square and Sawtooth get loops of their own, with the waveform chosen
+    // once for the block rather than on every sample
+    if(!bandLimited_ && waveformType_ == Square)
+    {
+        MixInSquareAudio(buffer, bufferSampleSize);
+        return;
+    }
+
+    if(!bandLimited_ && waveformType_ == Sawtooth)
+    {
+        MixInSawtoothAudio(buffer, bufferSampleSize);
+        return;
+    }
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        buffer[i] += static_cast<uint16_t>(RenderSample(1.0f));
+    }
+}
+
+// These work each sample out exactly as RenderSample does, so the oscillator sounds the same
+// whichever way it's rendered.  The state is kept in locals so the compiler can hold it in registers
+// across the block.
+void Oscillator::MixInSquareAudio(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    float cyclePosition = cyclePosition_;
+    const float samplesPerCycle = samplesPerCycle_;
+    const float peakLevel = peakLevel_;
+    const float pulseStart = pulseStart_;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        float cyclePercent = cyclePosition / samplesPerCycle;
+        buffer[i] += static_cast<uint16_t>((cyclePercent > pulseStart) ? peakLevel : 0.0f);
+
+        cyclePosition += 1.0f;
+        if(cyclePosition >= samplesPerCycle)
+        {
+            cyclePosition -= samplesPerCycle;
+            if(cyclePosition >= samplesPerCycle)
+            {
+                cyclePosition = fmodf(cyclePosition, samplesPerCycle);
+            }
+        }
+    }
+
+    cyclePosition_ = cyclePosition;
+}
+
+void Oscillator::MixInSawtoothAudio(uint16_t buffer[], uint32_t bufferSampleSize)
+{
+    float cyclePosition = cyclePosition_;
+    const float samplesPerCycle = samplesPerCycle_;
+    const float peakLevel = peakLevel_;
 
-    for(i = 0; i < bufferSampleSize; ++i)
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
     {
-        cyclePercent = fmodf(static_cast<float>(currentSample + i), samplesForOneCycle) / samplesForOneCycle;
+        buffer[i] += static_cast<uint16_t>(peakLevel * (cyclePosition / samplesPerCycle));
+
+        cyclePosition += 1.0f;
+        if(cyclePosition >= samplesPerCycle)
+        {
+            cyclePosition -= samplesPerCycle;
+            if(cyclePosition >= samplesPerCycle)
+            {
+                cyclePosition = fmodf(cyclePosition, samplesPerCycle);
+            }
+        }
+    }
+
+    cyclePosition_ = cyclePosition;
+}
+
+// Returns the sum of the unison voices' current values (each 0.0 to 1.0).  Each lane keeps its own
+// running sum so the voices can be added up several at a time.
+inline float Oscillator::SumUnisonVoices()
+{
+    // Local copies let the compiler see nothing in the loops changes the voice count
+    const uint32_t voiceCount = unisonLaneVoiceCount_;
+    const float pulseStart = pulseStart_;
+    float laneSums[UNISON_LANE_COUNT_] = { 0.0f, 0.0f, 0.0f, 0.0f };
 
-        if(waveformType_ == Square && cyclePercent > 0.5)
+    if(waveformType_ == Square)
+    {
+        for(uint32_t voice = 0; voice < voiceCount; voice += UNISON_LANE_COUNT_)
         {
-            buffer[i] += static_cast<uint16_t>(peakLevel);
+            for(uint32_t lane = 0; lane < UNISON_LANE_COUNT_; ++lane)
+            {
+                laneSums[lane] += static_cast<float>(unisonPhase_[voice + lane] > pulseStart) * unisonWeight_[voice + lane];
+            }
         }
-        else if(waveformType_ == Sawtooth)
+    }
+    else
+    {
+        for(uint32_t voice = 0; voice < voiceCount; voice += UNISON_LANE_COUNT_)
         {
-            buffer[i] += static_cast<uint16_t>(peakLevel * cyclePercent);
+            for(uint32_t lane = 0; lane < UNISON_LANE_COUNT_; ++lane)
+            {
+                laneSums[lane] += unisonPhase_[voice + lane] * unisonWeight_[voice + lane];
+            }
         }
     }
+
+    return (laneSums[0] + laneSums[1]) + (laneSums[2] + laneSums[3]);
+}
+
+// Moves every unison voice on by one sample.  This is written without branches so it works on
+// several voices at once.
+inline void Oscillator::AdvanceUnisonVoices(float rateScale)
+{
+    const uint32_t voiceCount = unisonLaneVoiceCount_;
+
+    // Keep every voice from moving a whole cycle or more in one sample (heavy FM on a high note),
+    // so a single wrap always brings it back into range.
+    const float maxRateScale = 0.99f / unisonMaxPhaseIncrement_;
+    if(rateScale > maxRateScale)
+    {
+        rateScale = maxRateScale;
+    }
+    else if(rateScale < -maxRateScale)
+    {
+        rateScale = -maxRateScale;
+    }
+
+    for(uint32_t voice = 0; voice < voiceCount; ++voice)
+    {
+        // The phase is now -1.0 to 2.0, so truncating one more than it gives 0, 1 or 2 cycles
+        float phase = unisonPhase_[voice] + unisonPhaseIncrement_[voice] * rateScale;
+        phase -= static_cast<float>(static_cast<int32_t>(phase + 1.0f) - 1);
+        unisonPhase_[voice] = phase;
+    }
+}
+
+// The per-sample unison render for when the oscillators are linked (see RenderSample).  The first
+// voice stands in for the whole stack as a modulator and for hard sync.
+float Oscillator::RenderUnisonSample(float rateScale)
+{
+    if(waveformType_ == None)
+    {
+        modulatorOutput_ = 0.0f;
+        return 0.0f;
+    }
+
+    float firstPhase = unisonPhase_[0];
+    if(waveformType_ == Square)
+    {
+        modulatorOutput_ = (firstPhase > pulseStart_) ? 1.0f : -1.0f;
+    }
+    else
+    {
+        modulatorOutput_ = firstPhase + firstPhase - 1.0f;
+    }
+
+    float value = peakLevel_ * unisonGain_ * SumUnisonVoices();
+    AdvanceUnisonVoices(rateScale);
+    cycleRestarted_ = (rateScale > 0.0f && unisonPhase_[0] < firstPhase);
+
+    return value;
+}
+
+void Oscillator::RestartCycle()
+{
+    cyclePosition_ = 0.0f;
+    samplePosition_ = 0.0f;
+
+    for(uint8_t voice = 0; voice < MAX_UNISON_COUNT; ++voice)
+    {
+        unisonPhase_[voice] = 0.0f;
+    }
+}
+
+void Oscillator::RestartSample()
+{
+    samplePosition_ = 0.0f;
+}
+
+void Oscillator::ResetLevelSmoothing()
+{
+    snapLevel_ = true;
+}
+
+void Oscillator::WrapCyclePosition()
+{
+    // Only reached when the position is more than a cycle out of range, which takes heavy
+    // through-zero FM on a high note.
+    cyclePosition_ = fmodf(cyclePosition_, samplesPerCycle_);
+    if(cyclePosition_ < 0.0f)
+    {
+        cyclePosition_ += samplesPerCycle_;
+    }
 }
 
-float Oscillator::GetSamplesPerCycle(uint8_t noteIndex)
+void Oscillator::UpdateTuning(uint8_t noteIndex, Tuning& tuning)
 {
-    float frequency;
-    float centAdjustment = static_cast<float>(cent_ / 100.0);
+    tuningChangeCount_ = tuning.GetChangeCount();
+    tunedSamplesPerCycle_ = GetSamplesPerCycle(noteIndex, tuning);
+    tunedNoteIndex_ = noteIndex;
+    tuningChanged_ = false;
+}
 
+float Oscillator::GetSamplesPerCycle(uint8_t noteIndex, Tuning& tuning)
+{
     if(noteIndex == 0)
     {
         return 0.0;
     }
 
-    uint8_t newNoteIndex = noteIndex + semitone_;
-    frequency = GetFrequency(newNoteIndex);
-    if(centAdjustment > 0.001)
+    // The offset can take the note past either end of the keyboard, where it's held at the last key
+    int16_t newNoteIndex = static_cast<int16_t>(noteIndex) + semitone_;
+    if(newNoteIndex < 0)
     {
-        frequency += (GetFrequency(newNoteIndex + 1) - GetFrequency(newNoteIndex)) * centAdjustment;
+        newNoteIndex = 0;
     }
-    else if(centAdjustment < -0.001)
+    else if(newNoteIndex > Tuning::NOTE_COUNT - 1)
     {
-        frequency += (GetFrequency(newNoteIndex) - GetFrequency(newNoteIndex - 1)) * centAdjustment;
+        newNoteIndex = Tuning::NOTE_COUNT - 1;
     }
 
-    return 44100.0f / frequency;
+    return tuning.GetSamplesPerCycle(static_cast<uint8_t>(newNoteIndex)) * centRatio_;
 }
 
@@ -27,31 +27,355 @@
 #pragma once
 
 #include <stdint.h>
+#include <math.h>
 #include "AudioGeneration/WaveformTypes.h"
+#include "AudioGeneration/SampleData.h"
+#include "AudioGeneration/Tuning.h"
 
 class Oscillator
 {
     public:
         Oscillator();
-        Oscillator(WaveformType waveformType, uint8_t level, int8_t cent, int8_t semitone);
+        Oscillator(WaveformType waveformType, uint8_t level, int16_t cent, int8_t semitone);
 
-        void MixInOscillatorAudio(uint16_t buffer[], uint32_t bufferSampleSize, uint8_t totalOscillatorCount, uint8_t noteIndex, uint32_t currentSample);
+        // Sets up everything that only changes at control rate, so call this before rendering each
+        // block's samples.  The note is looked up in the tuning.  The pitch modulation is a
+        // frequency multiplier, the level modulation a gain (0.0 to 1.0) and the pulse width
+        // modulation an offset to the pulse width (-1.0 to 1.0 of a full cycle).
+        void StartBlock(uint8_t totalOscillatorCount, uint8_t noteIndex, Tuning& tuning, float pitchModulation,
+                        float levelModulation, float pulseWidthModulation);
+
+        // Mixes the block's samples into the buffer when nothing else depends on this oscillator.
+        void MixInOscillatorAudio(uint16_t buffer[], uint32_t bufferSampleSize);
+
+        // Returns the next sample (0 to the oscillator's peak level) and advances the oscillator.  The
+        // rate scale multiplies how fast the oscillator moves through its cycle, so 1.0 plays at the
+        // oscillator's own pitch and a negative rate runs the cycle backward (for through-zero FM).
+        // This is called per sample by the voice's render loop, so it's defined inline below.
+        float RenderSample(float rateScale);
+
+        // The last rendered sample as a -1.0 to 1.0 signal, regardless of level, for modulating
+        // another oscillator.
+        float GetModulatorOutput();
+
+        // Whether the last RenderSample call wrapped around to the start of a new cycle.
+        bool GetCycleRestarted();
+
+        // The middle of the oscillator's output range for the current block (half its peak level),
+        // which its waveforms swing around.  Zero when the oscillator's off.
+        float GetCenterLevel();
+
+        // Jumps back to the start of the cycle (for hard sync).  The Sample waveform starts its
+        // sample over too.
+        void RestartCycle();
+
+        // Starts the Sample waveform's sample over (for a new note).
+        void RestartSample();
+
+        // Changes in level are smoothed out over a few blocks to avoid clicks.  When a new note
+        // starts there's nothing to click against, so this has the next block jump straight to
+        // the new level.
+        void ResetLevelSmoothing();
 
         WaveformType GetWaveformType();
         uint8_t GetLevel();
-        int8_t GetCent();
+        int16_t GetCent();
         int8_t GetSemitone();
+        uint8_t GetPulseWidth();
+        bool GetBandLimited();
+        uint8_t GetUnisonCount();
+        uint8_t GetUnisonSpread();
+        const SampleData* GetSample();
 
         void SetWaveformType(WaveformType waveformType);
         void SetLevel(uint8_t level);
-        void SetCent(int8_t cent);
+        void SetCent(int16_t cent);
         void SetSemitone(int8_t semitone);
+        void SetPulseWidth(uint8_t pulseWidth);
+        void SetBandLimited(bool bandLimited);
+        void SetUnisonCount(uint8_t unisonCount);
+        void SetUnisonSpread(uint8_t unisonSpread);
+
+        // The sample the Sample waveform plays.  It has to stay around (it's normally a const in
+        // flash) as it's read in place rather than copied.
+        void SetSample(const SampleData* sample);
+
+        // The cent offset is applied as an exact ratio, so the range is only limited by these
+        static const int16_t MIN_CENT = -100;
+        static const int16_t MAX_CENT = 100;
+
+        // The pulse width is the percentage of the Square cycle spent high
+        static const uint8_t MIN_PULSE_WIDTH = 5;
+        static const uint8_t MAX_PULSE_WIDTH = 95;
+
+        // In unison the oscillator plays up to 16 copies of its waveform, detuned evenly across
+        // +/- the spread (in cents).
+        static const uint8_t MAX_UNISON_COUNT = 16;
+        static const uint8_t MAX_UNISON_SPREAD = 50;
 
     private:
-        float GetSamplesPerCycle(uint8_t noteIndex);
+        float GetSamplesPerCycle(uint8_t noteIndex, Tuning& tuning);
+        void UpdateTuning(uint8_t noteIndex, Tuning& tuning);
+        void WrapCyclePosition();
+        void MixInSquareAudio(uint16_t buffer[], uint32_t bufferSampleSize);
+        void MixInSawtoothAudio(uint16_t buffer[], uint32_t bufferSampleSize);
+        static float PolyBLEP(float phase, float phaseIncrement);
+        void InitializeUnisonVoices();
+        void UpdateUnisonVoices();
+        float RenderUnisonSample(float rateScale);
+        float SumUnisonVoices();
+        void AdvanceUnisonVoices(float rateScale);
+        float NextWhiteNoise();
+        float NextPinkNoise();
+        float NextSampleValue(float rateScale);
+        float ReadSampleValue(uint32_t index);
 
         WaveformType waveformType_;
         uint8_t level_;
-        int8_t cent_;
+        int16_t cent_;
         int8_t semitone_;
+
+        // The cycle length multiplier for the cent offset, 2^(-cent / 1200)
+        float centRatio_;
+        uint8_t pulseWidth_;
+
+        // When set, the steps in the Square and Sawtooth waveforms are smoothed with a PolyBLEP
+        // correction, which takes out most of the aliasing for a few multiplies per sample.
+        bool bandLimited_;
+
+        // How far (in samples) we are into the current cycle.  Keeping this running, rather than
+        // deriving it from an absolute sample count, keeps the waveform continuous when the pitch
+        // changes from one block to the next.
+        float cyclePosition_;
+
+        // The note's cycle length with the cent and semitone applied.  It's only recalculated when
+        // one of those (or the tuning table) changes rather than every block.
+        uint8_t tunedNoteIndex_;
+        bool tuningChanged_;
+        uint32_t tuningChangeCount_;
+        float tunedSamplesPerCycle_;
+
+        // Whether the next block should jump straight to its level rather than smoothing toward it
+        bool snapLevel_;
+
+        // Set by StartBlock for the current control block
+        float samplesPerCycle_;
+        float phaseIncrement_;
+        float peakLevel_;
+        float halfPeakLevel_;
+        float pulseStart_;
+
+        // Set by RenderSample for the last sample
+        float modulatorOutput_;
+        bool cycleRestarted_;
+
+        // The noise comes from a xorshift generator.  Pink noise is the white noise through three
+        // one pole low pass filters (Paul Kellet's "economy" pink noise filter).
+        uint32_t noiseState_;
+        float pinkNoiseFilter_[3];
+        static const uint32_t NOISE_SEED_ = 2463534242u;
+
+        // The Sample waveform's position in the sample (in the sample's own samples) and how far it
+        // moves each output sample at the current pitch
+        const SampleData* sample_;
+        float samplePosition_;
+        float sampleIncrement_;
+
+        // The unison voices are kept as separate arrays (rather than an array of voices) so the
+        // per-voice loops can work on several voices at once.  Each voice's phase is 0.0 to 1.0.
+        // The voice count is rounded up to a whole number of lanes, with the extra voices given a
+        // weight of zero, so those loops never need a remainder.
+        static const uint8_t UNISON_LANE_COUNT_ = 4;
+        uint8_t unisonCount_;
+        uint8_t unisonSpread_;
+        uint8_t unisonLaneVoiceCount_;
+        bool renderUnison_;
+        float unisonGain_;
+        float unisonMaxPhaseIncrement_;
+        float unisonDetune_[MAX_UNISON_COUNT];
+        float unisonWeight_[MAX_UNISON_COUNT];
+        float unisonPhase_[MAX_UNISON_COUNT];
+        float unisonPhaseIncrement_[MAX_UNISON_COUNT];
 };
+
+inline float Oscillator::RenderSample(float rateScale)
+{
+    if(renderUnison_)
+    {
+        return RenderUnisonSample(rateScale);
+    }
+
+    float cyclePercent = cyclePosition_ / samplesPerCycle_;
+    float value = 0.0f;
+
+    if(waveformType_ == Square)
+    {
+        bool high = (cyclePercent > pulseStart_);
+        modulatorOutput_ = high ? 1.0f : -1.0f;
+        value = high ? peakLevel_ : 0.0f;
+        if(bandLimited_)
+        {
+            // A step up at the start of the pulse and back down at the end of the cycle
+            float phaseIncrement = phaseIncrement_ * fabsf(rateScale);
+            float pulsePhase = cyclePercent - pulseStart_;
+            if(pulsePhase < 0.0f)
+            {
+                pulsePhase += 1.0f;
+            }
+            value += halfPeakLevel_ * PolyBLEP(pulsePhase, phaseIncrement);
+            value -= halfPeakLevel_ * PolyBLEP(cyclePercent, phaseIncrement);
+        }
+    }
+    else if(waveformType_ == Sawtooth)
+    {
+        modulatorOutput_ = cyclePercent + cyclePercent - 1.0f;
+        value = peakLevel_ * cyclePercent;
+        if(bandLimited_)
+        {
+            value -= halfPeakLevel_ * PolyBLEP(cyclePercent, phaseIncrement_ * fabsf(rateScale));
+        }
+    }
+    else if(waveformType_ == Noise || waveformType_ == PinkNoise)
+    {
+        // Noise has no cycle of its own, but it keeps moving through one at the oscillator's pitch
+        // so hard sync still works with it
+        modulatorOutput_ = (waveformType_ == Noise) ? NextWhiteNoise() : NextPinkNoise();
+        value = halfPeakLevel_ + halfPeakLevel_ * modulatorOutput_;
+    }
+    else if(waveformType_ == Sample)
+    {
+        modulatorOutput_ = NextSampleValue(rateScale);
+        value = halfPeakLevel_ + halfPeakLevel_ * modulatorOutput_;
+    }
+    else
+    {
+        modulatorOutput_ = 0.0f;
+        return 0.0f;
+    }
+
+    cyclePosition_ += rateScale;
+    cycleRestarted_ = false;
+    if(cyclePosition_ >= samplesPerCycle_)
+    {
+        cyclePosition_ -= samplesPerCycle_;
+        cycleRestarted_ = true;
+        if(cyclePosition_ >= samplesPerCycle_)
+        {
+            WrapCyclePosition();
+        }
+    }
+    else if(cyclePosition_ < 0.0f)
+    {
+        cyclePosition_ += samplesPerCycle_;
+        if(cyclePosition_ < 0.0f)
+        {
+            WrapCyclePosition();
+        }
+    }
+
+    return value;
+}
+
+inline float Oscillator::GetModulatorOutput()
+{
+    return modulatorOutput_;
+}
+
+inline bool Oscillator::GetCycleRestarted()
+{
+    return cycleRestarted_;
+}
+
+// Returns the next white noise sample (-1.0 to 1.0).
+inline float Oscillator::NextWhiteNoise()
+{
+    // Marsaglia's xorshift32
+    noiseState_ ^= noiseState_ << 13;
+    noiseState_ ^= noiseState_ >> 17;
+    noiseState_ ^= noiseState_ << 5;
+    return static_cast<float>(static_cast<int32_t>(noiseState_ >> 16) - 32768) / 32768.0f;
+}
+
+// Returns the next pink noise sample (-1.0 to 1.0).  The gain leaves enough headroom that the clamp
+// only catches the rare peak.
+inline float Oscillator::NextPinkNoise()
+{
+    float white = NextWhiteNoise();
+    pinkNoiseFilter_[0] = 0.99765f * pinkNoiseFilter_[0] + white * 0.0990460f;
+    pinkNoiseFilter_[1] = 0.96300f * pinkNoiseFilter_[1] + white * 0.2965164f;
+    pinkNoiseFilter_[2] = 0.57000f * pinkNoiseFilter_[2] + white * 1.0526913f;
+
+    float pink = (pinkNoiseFilter_[0] + pinkNoiseFilter_[1] + pinkNoiseFilter_[2] + white * 0.1848f) * 0.15f;
+    if(pink > 1.0f) { pink = 1.0f; }
+    else if(pink < -1.0f) { pink = -1.0f; }
+
+    return pink;
+}
+
+// Returns the sample's value (-1.0 to 1.0) at the playback position, interpolating between the
+// stored samples, and moves the position on.  The rate scale works as it does for the other
+// waveforms, except that running backward stops at the start of the sample.
+inline float Oscillator::NextSampleValue(float rateScale)
+{
+    const SampleData& sample = *sample_;
+    uint32_t index = static_cast<uint32_t>(samplePosition_);
+
+    // A sample that doesn't loop is silent once it's played through
+    if(index >= sample.length)
+    {
+        return 0.0f;
+    }
+
+    uint32_t nextIndex = index + 1;
+    if(nextIndex == sample.loopEnd) { nextIndex = sample.loopStart; }
+    else if(nextIndex == sample.length) { nextIndex = index; }
+
+    float fraction = samplePosition_ - static_cast<float>(index);
+    float current = ReadSampleValue(index);
+    float value = current + fraction * (ReadSampleValue(nextIndex) - current);
+
+    samplePosition_ += sampleIncrement_ * rateScale;
+    if(samplePosition_ < 0.0f)
+    {
+        samplePosition_ = 0.0f;
+    }
+    else if(sample.loopEnd != 0)
+    {
+        while(samplePosition_ >= static_cast<float>(sample.loopEnd))
+        {
+            samplePosition_ -= static_cast<float>(sample.loopEnd - sample.loopStart);
+        }
+    }
+
+    return value;
+}
+
+// Reads one of the sample's stored samples (-1.0 to 1.0) straight from flash
+inline float Oscillator::ReadSampleValue(uint32_t index)
+{
+    if(sample_->data16 != 0)
+    {
+        return static_cast<float>(sample_->data16[index]) * (1.0f / 32768.0f);
+    }
+
+    return static_cast<float>(sample_->data8[index]) * (1.0f / 128.0f);
+}
+
+// The PolyBLEP residual for a step at phase 0 of a waveform with the given phase increment per
+// sample.  It's non-zero only for the sample on each side of the step, and is scaled for a step with
+// a height of 2.
+inline float Oscillator::PolyBLEP(float phase, float phaseIncrement)
+{
+    if(phase < phaseIncrement)
+    {
+        phase /= phaseIncrement;
+        return phase + phase - phase * phase - 1.0f;
+    }
+    else if(phase > 1.0f - phaseIncrement)
+    {
+        phase = (phase - 1.0f) / phaseIncrement;
+        return phase * phase + phase + phase + 1.0f;
+    }
+
+    return 0.0f;
+}
@@ -0,0 +1,137 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/OutputStage.h"
+#include <math.h>
+
+const float fullScale = 32767.0f;
+
+// y[n] = x[n] - x[n-1] + R * y[n-1], which puts the corner at about 35 Hz
+const float dcBlockerPole = 0.995f;
+
+// The limiter grabs a peak instantly and lets go of it by this much per sample (about a 100 ms
+// time constant)
+const float limiterRelease = 0.99977f;
+
+// The soft clip is y = 1.5x - 0.5x^3 (over -1 to 1).  Scaling its input by 1/1.5 gives it unity
+// gain around zero, and it flattens out to exactly full scale at 1.5 times full scale.
+const float softClipInputScale = 1.0f / (1.5f * fullScale);
+
+OutputStage::OutputStage() :
+    enabled_(false),
+    gain_(0),
+    limiter_(true),
+    dither_(false),
+    gainFactor_(1.0f),
+    dcInput_(0.0f),
+    dcOutput_(0.0f),
+    envelope_(0.0f) { }
+
+bool OutputStage::GetEnabled()
+{
+    return enabled_;
+}
+
+uint8_t OutputStage::GetGain()
+{
+    return gain_;
+}
+
+bool OutputStage::GetLimiter()
+{
+    return limiter_;
+}
+
+bool OutputStage::GetDither()
+{
+    return dither_;
+}
+
+void OutputStage::SetEnabled(bool enabled)
+{
+    // Start afresh rather than from wherever the DC blocker and limiter were last switched off
+    if(enabled && !enabled_)
+    {
+        dcInput_ = 0.0f;
+        dcOutput_ = 0.0f;
+        envelope_ = 0.0f;
+    }
+
+    enabled_ = enabled;
+}
+
+void OutputStage::SetGain(uint8_t gain)
+{
+    if(gain > MAX_GAIN) { gain_ = MAX_GAIN; }
+    else { gain_ = gain; }
+
+    gainFactor_ = powf(10.0f, static_cast<float>(gain_) / 20.0f);
+}
+
+void OutputStage::SetLimiter(bool limiter)
+{
+    limiter_ = limiter;
+}
+
+void OutputStage::SetDither(bool dither)
+{
+    dither_ = dither;
+}
+
+void OutputStage::Process(float buffer[], uint32_t bufferSampleSize)
+{
+    const float gainFactor = gainFactor_;
+    const bool limiter = limiter_;
+    float dcInput = dcInput_;
+    float dcOutput = dcOutput_;
+    float envelope = envelope_;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        float input = buffer[i];
+        dcOutput = input - dcInput + dcBlockerPole * dcOutput;
+        dcInput = input;
+
+        float sample = dcOutput * gainFactor;
+
+        if(limiter)
+        {
+            float peak = (sample < 0.0f) ? -sample : sample;
+            envelope *= limiterRelease;
+            if(peak > envelope) { envelope = peak; }
+            if(envelope > fullScale) { sample *= fullScale / envelope; }
+        }
+
+        float x = sample * softClipInputScale;
+        if(x > 1.0f) { x = 1.0f; }
+        else if(x < -1.0f) { x = -1.0f; }
+        buffer[i] = fullScale * x * (1.5f - 0.5f * x * x);
+    }
+
+    dcInput_ = dcInput;
+    dcOutput_ = dcOutput;
+    envelope_ = envelope;
+}
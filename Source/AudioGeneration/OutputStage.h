@@ -0,0 +1,73 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// The master output stage, run on each control block just before it's converted to the DAC's
+// unsigned format.  In order, it removes DC (a one-pole high pass at about 35 Hz), applies the
+// make-up gain, pulls peaks back under full scale with a look-ahead-free limiter and finally
+// rounds off whatever's left with a cubic soft clip rather than hard clipping at the DAC rails.
+// Samples are signed and in DAC units (i.e. full scale is +/-32767).
+class OutputStage
+{
+    public:
+        OutputStage();
+
+        bool GetEnabled();
+        uint8_t GetGain();
+        bool GetLimiter();
+        bool GetDither();
+
+        // The stage is off by default, leaving the mix exactly as the oscillators and filter made it
+        void SetEnabled(bool enabled);
+
+        // The gain is in dB
+        void SetGain(uint8_t gain);
+        void SetLimiter(bool limiter);
+
+        // Dither is added (by the mixer) when the stage's output is rounded to the DAC's 16 bits
+        void SetDither(bool dither);
+
+        void Process(float buffer[], uint32_t bufferSampleSize);
+
+        static const uint8_t MAX_GAIN = 18;
+
+    private:
+        bool enabled_;
+        uint8_t gain_;
+        bool limiter_;
+        bool dither_;
+        float gainFactor_;
+
+        // DC blocker state (the last input and output)
+        float dcInput_;
+        float dcOutput_;
+
+        // The limiter's peak envelope
+        float envelope_;
+};
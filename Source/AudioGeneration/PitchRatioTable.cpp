@@ -0,0 +1,71 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/PitchRatioTable.h"
+
+// 2^(i / 64) for one octave, i.e. a point every 1200 / 64 cents
+const int32_t ratioSegmentCount = 64;
+const float centsPerOctave = 1200.0f;
+const float ratioTable[ratioSegmentCount + 1] =
+{
+    1.000000000f, 1.010889286f, 1.021897149f, 1.033024879f, 1.044273782f, 1.055645178f,
+    1.067140401f, 1.078760798f, 1.090507733f, 1.102382583f, 1.114386743f, 1.126521619f,
+    1.138788635f, 1.151189230f, 1.163724859f, 1.176396992f, 1.189207115f, 1.202156731f,
+    1.215247360f, 1.228480536f, 1.241857812f, 1.255380757f, 1.269050957f, 1.282870016f,
+    1.296839555f, 1.310961212f, 1.325236643f, 1.339667524f, 1.354255547f, 1.369002423f,
+    1.383909882f, 1.398979673f, 1.414213562f, 1.429613338f, 1.445180807f, 1.460917794f,
+    1.476826146f, 1.492907728f, 1.509164428f, 1.525598151f, 1.542210825f, 1.559004400f,
+    1.575980845f, 1.593142151f, 1.610490332f, 1.628027422f, 1.645755478f, 1.663676580f,
+    1.681792831f, 1.700106354f, 1.718619298f, 1.737333835f, 1.756252160f, 1.775376493f,
+    1.794709075f, 1.814252176f, 1.834008086f, 1.853979125f, 1.874167634f, 1.894575982f,
+    1.915206561f, 1.936061793f, 1.957144124f, 1.978456026f, 2.000000000f
+};
+
+float GetCentRatio(float cents)
+{
+    // Split the offset into whole octaves and a 0 to 1200 cent remainder
+    float octaveScale = 1.0f;
+    while(cents >= centsPerOctave)
+    {
+        cents -= centsPerOctave;
+        octaveScale *= 2.0f;
+    }
+    while(cents < 0.0f)
+    {
+        cents += centsPerOctave;
+        octaveScale *= 0.5f;
+    }
+
+    float position = cents * (ratioSegmentCount / centsPerOctave);
+    int32_t index = static_cast<int32_t>(position);
+    if(index >= ratioSegmentCount)
+    {
+        index = ratioSegmentCount - 1;
+    }
+    float fraction = position - static_cast<float>(index);
+
+    return octaveScale * (ratioTable[index] + (ratioTable[index + 1] - ratioTable[index]) * fraction);
+}
@@ -0,0 +1,189 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/Reverb.h"
+
+// Freeverb's (left channel) delay lengths
+const uint16_t combLengths[] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+const uint16_t allpassLengths[] = { 556, 441, 341, 225 };
+
+// The input is scaled down before it goes into the combs, which leaves headroom for the combs to
+// ring up in 16 bits, and the wet signal is scaled back up to about the level of the input
+const float reverbInputGain = 0.05f;
+const float reverbWetGain = 1.0f;
+
+// The comb feedback runs from 0.7 (smallest) to 0.98 (largest), and each comb's feedback goes
+// through a one-pole low pass so the highs die away first
+const float minimumCombFeedback = 0.7f;
+const float combFeedbackRange = 0.28f;
+const float combDamping = 0.2f;
+
+const float allpassFeedback = 0.5f;
+
+Reverb::Reverb() :
+    mix_(0),
+    size_(50),
+    feedback_(minimumCombFeedback + combFeedbackRange * 0.5f)
+{
+    uint16_t start = 0;
+
+    for(uint32_t i = 0; i < COMB_COUNT_; ++i)
+    {
+        combStart_[i] = start;
+        combLength_[i] = static_cast<uint16_t>(combLengths[i] / REVERB_TANK_DIVISOR);
+        start += combLength_[i];
+    }
+
+    for(uint32_t i = 0; i < ALLPASS_COUNT_; ++i)
+    {
+        allpassStart_[i] = start;
+        allpassLength_[i] = static_cast<uint16_t>(allpassLengths[i] / REVERB_TANK_DIVISOR);
+        start += allpassLength_[i];
+    }
+
+    Clear();
+}
+
+uint8_t Reverb::GetMix()
+{
+    return mix_;
+}
+
+uint8_t Reverb::GetSize()
+{
+    return size_;
+}
+
+void Reverb::SetMix(uint8_t mix)
+{
+    if(mix > MAX_MIX) { mix = MAX_MIX; }
+
+    // Whatever was left in the tank from the last time the reverb was on shouldn't come back
+    if(mix_ == 0 && mix != 0)
+    {
+        Clear();
+    }
+
+    mix_ = mix;
+}
+
+void Reverb::SetSize(uint8_t size)
+{
+    if(size > MAX_SIZE) { size_ = MAX_SIZE; }
+    else { size_ = size; }
+
+    feedback_ = minimumCombFeedback + combFeedbackRange * static_cast<float>(size_) / MAX_SIZE;
+}
+
+void Reverb::Clear()
+{
+    for(uint32_t i = 0; i < ARENA_SIZE_; ++i)
+    {
+        arena_[i] = 0;
+    }
+
+    for(uint32_t i = 0; i < COMB_COUNT_; ++i)
+    {
+        combIndex_[i] = 0;
+        combDamping_[i] = 0.0f;
+    }
+
+    for(uint32_t i = 0; i < ALLPASS_COUNT_; ++i)
+    {
+        allpassIndex_[i] = 0;
+    }
+}
+
+// Each filter runs over the whole block before moving on to the next, which keeps its state in
+// registers rather than reloading it for every sample.
+void Reverb::Process(float buffer[], uint32_t bufferSampleSize)
+{
+    float input[CONTROL_BLOCK_SIZE];
+    float wet[CONTROL_BLOCK_SIZE];
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        input[i] = buffer[i] * reverbInputGain;
+        wet[i] = 0.0f;
+    }
+
+    const float feedback = feedback_;
+
+    for(uint32_t comb = 0; comb < COMB_COUNT_; ++comb)
+    {
+        int16_t* delay = &(arena_[combStart_[comb]]);
+        const uint16_t length = combLength_[comb];
+        uint16_t index = combIndex_[comb];
+        float damping = combDamping_[comb];
+
+        for(uint32_t i = 0; i < bufferSampleSize; ++i)
+        {
+            float output = static_cast<float>(delay[index]);
+            damping = output + (damping - output) * combDamping;
+
+            int32_t sample = static_cast<int32_t>(input[i] + damping * feedback);
+            if(sample > 32767) { sample = 32767; }
+            else if(sample < -32767) { sample = -32767; }
+            delay[index] = static_cast<int16_t>(sample);
+
+            if(++index == length) { index = 0; }
+            wet[i] += output;
+        }
+
+        combIndex_[comb] = index;
+        combDamping_[comb] = damping;
+    }
+
+    for(uint32_t allpass = 0; allpass < ALLPASS_COUNT_; ++allpass)
+    {
+        int16_t* delay = &(arena_[allpassStart_[allpass]]);
+        const uint16_t length = allpassLength_[allpass];
+        uint16_t index = allpassIndex_[allpass];
+
+        for(uint32_t i = 0; i < bufferSampleSize; ++i)
+        {
+            float delayed = static_cast<float>(delay[index]);
+
+            int32_t sample = static_cast<int32_t>(wet[i] + delayed * allpassFeedback);
+            if(sample > 32767) { sample = 32767; }
+            else if(sample < -32767) { sample = -32767; }
+            delay[index] = static_cast<int16_t>(sample);
+
+            if(++index == length) { index = 0; }
+            wet[i] = delayed - wet[i];
+        }
+
+        allpassIndex_[allpass] = index;
+    }
+
+    const float wetLevel = reverbWetGain * static_cast<float>(mix_) / MAX_MIX;
+    const float dryLevel = 1.0f - static_cast<float>(mix_) / MAX_MIX;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        buffer[i] = buffer[i] * dryLevel + wet[i] * wetLevel;
+    }
+}
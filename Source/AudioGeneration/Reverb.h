@@ -0,0 +1,79 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "AudioGeneration/AudioSettings.h"
+
+// A Freeverb style reverb: eight damped feedback comb filters in parallel, followed by four
+// allpass filters in series.  The delays all come out of one arena of 16 bit samples whose size
+// is fixed at compile time by REVERB_TANK_DIVISOR.  Samples are signed and in DAC units.
+class Reverb
+{
+    public:
+        // The mix (zero turns the reverb off) and size are percentages
+        static const uint8_t MAX_MIX = 100;
+        static const uint8_t MAX_SIZE = 100;
+
+        Reverb();
+
+        uint8_t GetMix();
+        uint8_t GetSize();
+
+        void SetMix(uint8_t mix);
+        void SetSize(uint8_t size);
+
+        // The buffer can hold up to a control block of samples
+        void Process(float buffer[], uint32_t bufferSampleSize);
+
+    private:
+        void Clear();
+
+        static const uint32_t COMB_COUNT_ = 8;
+        static const uint32_t ALLPASS_COUNT_ = 4;
+
+        // Freeverb's delay lengths (at 44.1 kHz) add up to this.  Each one is rounded down when
+        // it's divided, so this is enough room whatever the divisor.
+        static const uint32_t FULL_TANK_SIZE_ = 11024 + 1563;
+        static const uint32_t ARENA_SIZE_ = FULL_TANK_SIZE_ / REVERB_TANK_DIVISOR;
+
+        uint8_t mix_;
+        uint8_t size_;
+        float feedback_;
+
+        // Where each filter's delay starts in the arena, its length and its read/write position
+        uint16_t combStart_[COMB_COUNT_];
+        uint16_t combLength_[COMB_COUNT_];
+        uint16_t combIndex_[COMB_COUNT_];
+        float combDamping_[COMB_COUNT_];  // The state of the low pass in each comb's feedback
+
+        uint16_t allpassStart_[ALLPASS_COUNT_];
+        uint16_t allpassLength_[ALLPASS_COUNT_];
+        uint16_t allpassIndex_[ALLPASS_COUNT_];
+
+        int16_t arena_[ARENA_SIZE_];
+};
@@ -0,0 +1,49 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// PCM audio for the Sample waveform.  The samples are a const array, which the linker leaves in
+// flash, and the oscillator reads them straight from there.  These are generated from wave files
+// by the WaveToSample host tool (see Tests/WaveToSample).
+struct SampleData
+{
+    // Only one of these is set, depending on the sample's bit depth
+    const int8_t* data8;
+    const int16_t* data16;
+
+    uint32_t length;
+
+    // The loop's end is exclusive.  With no loop (an end of zero) the sample plays through once.
+    uint32_t loopStart;
+    uint32_t loopEnd;
+
+    // The sample plays back at its own rate for a note of the root frequency
+    float sampleRate;
+    float rootFrequency;
+};
@@ -0,0 +1,368 @@
+// Generated by WaveToSample from Keys.wav, don't edit by hand
+
+#include "AudioGeneration/Samples/KeysSample.h"
+
+const int16_t keysSampleData[4200] =
+{
+    0, 218, 830, 1715, 2709, 3639, 4368, 4817, 4981, 4923, 4743, 4553,
+    4438, 4440, 4548, 4708, 4848, 4900, 4829, 4643, 4390, 4144, 3978, 3942,
+    4043, 4241, 4463, 4618, 4631, 4464, 4128, 3679, 3207, 2800, 2523, 2391,
+    2366, 2364, 2281, 2025, 1545, 847, 0, -887, -1694, -2282, -2637, -2807,
+    -2892, -3011, -3273, -3741, -4411, -5212, -6028, -6733, -7229, -7477, -7514, -7443,
+    -7407, -7547, -7959, -8665, -9603, -10650, -11653, -12490, -13112, -13575, -14039, -14733,
+    -15893, -17680, -20111, -23008, -25993, -28528, -30000, -29840, -27636, -23239, -16810, -8824,
+    0, 8805, 16740, 23095, 27415, 29551, 29668, 28183, 25665, 22719, 19870, 17484,
+    15731, 14589, 13898, 13429, 12962, 12344, 11522, 10545, 9531, 8623, 7936, 7528,
+    7374, 7383, 7423, 7361, 7101, 6612, 5930, 5147, 4380, 3735, 3274, 2999,
+    2853, 2737, 2540, 2177, 1608, 857, 0, -856, -1604, -2169, -2531, -2728,
+    -2847, -2996, -3273, -3732, -4370, -5124, -5891, -6558, -7038, -7297, -7367, -7341,
+    -7346, -7508, -7912, -8578, -9451, -10420, -11350, -12133, -12724, -13173, -13623, -14276,
+    -15339, -16954, -19131, -21707, -24340, -26547, -27779, -27525, -25420, -21332, -15410, -8082,
+    0, 8066, 15347, 21204, 25222, 27266, 27481, 26237, 24044, 21444, 18910, 16772,
+    15187, 14139, 13489, 13035, 12581, 11993, 11224, 10317, 9376, 8530, 7881, 7480,
+    7306, 7277, 7276, 7183, 6914, 6440, 5794, 5058, 4335, 3719, 3267, 2980,
+    2807, 2660, 2441, 2073, 1522, 809, 0, -808, -1519, -2066, -2432, -2651,
+    -2800, -2976, -3265, -3715, -4323, -5034, -5756, -6389, -6854, -7121, -7220, -7233,
+    -7274, -7454, -7850, -8479, -9294, -10193, -11058, -11792, -12355, -12791, -13228, -13843,
+    -14820, -16281, -18233, -20525, -22848, -24767, -25787, -25454, -23439, -19629, -14160, -7421,
+    0, 7406, 14104, 19515, 23262, 25222, 25520, 24488, 22581, 20287, 18031, 16114,
+    14678, 13714, 13101, 12660, 12219, 11659, 10937, 10092, 9218, 8427, 7813, 7420,
+    7229, 7167, 7130, 7011, 6735, 6276, 5663, 4968, 4284, 3696, 3252, 2955,
+    2760, 2587, 2349, 1979, 1444, 764, 0, -763, -1441, -1972, -2341, -2578,
+    -2753, -2951, -3249, -3690, -4272, -4944, -5626, -6227, -6678, -6952, -7075, -7122,
+    -7193, -7389, -7777, -8373, -9135, -9972, -10779, -11468, -12005, -12430, -12853, -13435,
+    -14335, -15661, -17413, -19454, -21504, -23168, -24004, -23602, -21671, -18110, -13046, -6831,
+    0, 6818, 12996, 18008, 21513, 23395, 23765, 22918, 21263, 19238, 17229, 15506,
+    14202, 13314, 12733, 12306, 11878, 11342, 10663, 9874, 9059, 8319, 7736, 7350,
+    7145, 7055, 6987, 6846, 6565, 6119, 5536, 4878, 4231, 3667, 3232, 2927,
+    2713, 2518, 2265, 1892, 1373, 725, 0, -724, -1370, -1886, -2257, -2510,
+    -2706, -2922, -3227, -3660, -4217, -4855, -5500, -6072, -6510, -6789, -6934, -7009,
+    -7107, -7316, -7696, -8263, -8976, -9758, -10512, -11162, -11676, -12089, -12501, -13052,
+    -13883, -15089, -16665, -18485, -20293, -21734, -22409, -21950, -20095, -16757, -12054, -6307,
+    0, 6295, 12010, 16666, 19954, 21765, 22196, 21511, 20077, 18290, 16497, 14947,
+    13760, 12938, 12388, 11973, 11556, 11043, 10403, 9664, 8902, 8206, 7652, 7273,
+    7056, 6942, 6848, 6689, 6403, 5970, 5414, 4790, 4175, 3634, 3207, 2897,
+    2666, 2452, 2186, 1813, 1309, 688, 0, -688, -1306, -1808, -2179, -2445,
+    -2659, -2891, -3202, -3626, -4161, -4768, -5380, -5926, -6351, -6634, -6797, -6897,
+    -7017, -7237, -7610, -8149, -8821, -9552, -10260, -10874, -11367, -11770, -12170, -12693,
+    -13464, -14563, -15984, -17609, -19206, -20451, -20986, -20477, -18692, -15554, -11172, -5841,
+    0, 5831, 11133, 15474, 18567, 20313, 20795, 20251, 19012, 17433, 15831, 14433,
+    13350, 12587, 12065, 11660, 11255, 10763, 10157, 9463, 8748, 8093, 7564, 7192,
+    6965, 6831, 6715, 6539, 6251, 5830, 5297, 4705, 4118, 3598, 3179, 2864,
+    2620, 2391, 2115, 1742, 1251, 656, 0, -655, -1249, -1737, -2108, -2384,
+    -2614, -2859, -3174, -3590, -4105, -4683, -5265, -5788, -6202, -6488, -6665, -6787,
+    -6926, -7155, -7521, -8036, -8669, -9357, -10023, -10605, -11078, -11471, -11861, -12360,
+    -13077, -14082, -15366, -16820, -18230, -19305, -19717, -19167, -17446, -14486, -10390, -5428,
+    0, 5419, 10356, 14415, 17335, 19021, 19547, 19126, 18057, 16661, 15227, 13962,
+    12972, 12261, 11763, 11369, 10974, 10501, 9926, 9272, 8599, 7980, 7474, 7109,
+    6874, 6723, 6587, 6398, 6108, 5698, 5187, 4622, 4062, 3560, 3150, 2831,
+    2576, 2334, 2049, 1677, 1199, 627, 0, -626, -1196, -1672, -2043, -2327,
+    -2570, -2826, -3144, -3552, -4049, -4601, -5157, -5659, -6062, -6350, -6540, -6680,
+    -6836, -7071, -7431, -7924, -8523, -9172, -9800, -10354, -10810, -11194, -11574, -12050,
+    -12720, -13642, -14806, -16110, -17357, -18282, -18588, -18003, -16340, -13540, -9698, -5062,
+    0, 5054, 9667, 13477, 16242, 17874, 18437, 18123, 17202, 15967, 14681, 13533,
+    12623, 11960, 11483, 11100, 10713, 10258, 9710, 9091, 8456, 7869, 7384, 7026,
+    6785, 6618, 6466, 6266, 5974, 5575, 5084, 4544, 4007, 3522, 3119, 2798,
+    2534, 2281, 1989, 1618, 1152, 601, 0, -600, -1150, -1614, -1983, -2275,
+    -2528, -2793, -3113, -3514, -3994, -4524, -5056, -5539, -5932, -6221, -6422, -6577,
+    -6747, -6989, -7342, -7815, -8384, -8998, -9594, -10122, -10562, -10937, -11309, -11765,
+    -12392, -13242, -14300, -15473, -16578, -17372, -17586, -16972, -15362, -12703, -9086, -4739,
+    0, 4731, 9059, 12647, 15275, 16858, 17452, 17231, 16439, 15345, 14188, 13143,
+    12304, 11682, 11225, 10850, 10473, 10033, 9510, 8923, 8321, 7762, 7296, 6944,
+    6698, 6519, 6352, 6143, 5851, 5461, 4988, 4469, 3954, 3485, 3088, 2766,
+    2494, 2232, 1934, 1565, 1110, 577, 0, -577, -1108, -1561, -1929, -2226,
+    -2488, -2761, -3082, -3477, -3942, -4451, -4962, -5427, -5812, -6102, -6311, -6480,
+    -6661, -6908, -7255, -7711, -8253, -8836, -9402, -9908, -10334, -10701, -11065, -11504,
+    -12094, -12879, -13846, -14903, -15884, -16565, -16699, -16061, -14498, -11965, -8546, -4454,
+    0, 4447, 8522, 11916, 14421, 15960, 16581, 16440, 15761, 14789, 13744, 12790,
+    12013, 11427, 10988, 10622, 10252, 9826, 9325, 8766, 8194, 7661, 7211, 6864,
+    6614, 6425, 6247, 6030, 5737, 5355, 4899, 4400, 3903, 3448, 3058, 2734,
+    2456, 2187, 1885, 1518, 1072, 556, 0, -556, -1070, -1514, -1880, -2182,
+    -2451, -2729, -3052, -3440, -3891, -4382, -4874, -5325, -5701, -5991, -6208, -6388,
+    -6579, -6830, -7171, -7612, -8131, -8686, -9226, -9712, -10126, -10486, -10842, -11265,
+    -11822, -12552, -13438, -14395, -15268, -15851, -15916, -15258, -13738, -11316, -8072, -4203,
+    0, 4198, 8051, 11272, 13670, 15169, 15812, 15740, 15159, 14293, 13347, 12472,
+    11749, 11195, 10772, 10413, 10051, 9638, 9156, 8622, 8075, 7565, 7129, 6789,
+    6535, 6337, 6149, 5925, 5633, 5259, 4816, 4335, 3855, 3412, 3028, 2705,
+    2421, 2146, 1840, 1475, 1038, 538, 0, -537, -1037, -1472, -1836, -2141,
+    -2417, -2700, -3023, -3405, -3844, -4319, -4794, -5231, -5600, -5890, -6114, -6303,
+    -6502, -6756, -7092, -7519, -8017, -8548, -9066, -9534, -9936, -10290, -10639, -11048,
+    -11577, -12258, -13074, -13943, -14723, -15221, -15226, -14552, -13070, -10746, -7656, -3984,
+    0, 3979, 7638, 10708, 13011, 14474, 15135, 15123, 14627, 13854, 12993, 12186,
+    11512, 10986, 10576, 10224, 9869, 9466, 9002, 8490, 7966, 7475, 7053, 6717,
+    6461, 6255, 6059, 5830, 5538, 5172, 4742, 4276, 3811, 3379, 3000, 2676,
+    2389, 2108, 1800, 1437, 1008, 521, 0, -521, -1007, -1435, -1796, -2104,
+    -2385, -2672, -2995, -3372, -3800, -4261, -4721, -5146, -5509, -5798, -6027, -6224,
+    -6431, -6686, -7018, -7433, -7913, -8422, -8920, -9373, -9765, -10113, -10456, -10853,
+    -11357, -11995, -12750, -13545, -14243, -14667, -14622, -13935, -12487, -10249, -7293, -3792,
+    0, 3788, 7277, 10216, 12435, 13867, 14543, 14582, 14159, 13466, 12679, 11932,
+    11298, 10797, 10400, 10054, 9705, 9312, 8863, 8370, 7866, 7392, 6982, 6651,
+    6392, 6181, 5977, 5744, 5453, 5093, 4674, 4222, 3769, 3347, 2974, 2650,
+    2360, 2075, 1764, 1404, 982, 507, 0, -506, -981, -1401, -1761, -2071,
+    -2356, -2646, -2969, -3341, -3760, -4208, -4656, -5070, -5426, -5716, -5948, -6152,
+    -6365, -6622, -6950, -7354, -7818, -8309, -8790, -9228, -9612, -9954, -10293, -10679,
+    -11161, -11762, -12465, -13194, -13823, -14184, -14096, -13397, -11979, -9816, -6977, -3626,
+    0, 3622, 6963, 9788, 11934, 13338, 14026, 14109, 13749, 13125, 12402, 11706,
+    11109, 10629, 10242, 9902, 9558, 9174, 8738, 8262, 7776, 7317, 6917, 6590,
+    6330, 6113, 5904, 5667, 5376, 5022, 4613, 4173, 3732, 3319, 2950, 2626,
+    2333, 2045, 1733, 1374, 959, 494, 0, -494, -958, -1372, -1730, -2042,
+    -2330, -2622, -2945, -3313, -3724, -4161, -4597, -5002, -5353, -5641, -5878, -6087,
+    -6305, -6564, -6888, -7282, -7732, -8207, -8673, -9100, -9476, -9813, -10147, -10524,
+    -10987, -11557, -12214, -12887, -13456, -13763, -13638, -12930, -11539, -9442, -6704, -3482,
+    0, 3479, 6692, 9417, 11501, 12879, 13578, 13699, 13392, 12827, 12159, 11508,
+    10941, 10479, 10102, 9767, 9428, 9052, 8627, 8165, 7694, 7249, 6858, 6534,
+    6273, 6052, 5838, 5598, 5308, 4959, 4559, 4129, 3698, 3292, 2928, 2604,
+    2309, 2019, 1705, 1348, 939, 483, 0, -483, -938, -1347, -1703, -2016,
+    -2306, -2601, -2924, -3287, -3691, -4118, -4544, -4941, -5288, -5576, -5815, -6029,
+    -6251, -6511, -6832, -7218, -7656, -8117, -8570, -8986, -9356, -9689, -10019, -10387,
+    -10834, -11377, -11996, -12621, -13139, -13400, -13244, -12529, -11161, -9120, -6470, -3358,
+    0, 3356, 6459, 9099, 11128, 12485, 13193, 13345, 13084, 12569, 11948, 11334,
+    10794, 10349, 9980, 9649, 9314, 8944, 8530, 8080, 7622, 7188, 6805, 6485,
+    6223, 5998, 5780, 5538, 5249, 4904, 4511, 4090, 3668, 3269, 2908, 2585,
+    2288, 1995, 1681, 1326, 922, 473, 0, -473, -921, -1325, -1679, -1993,
+    -2286, -2582, -2904, -3264, -3661, -4081, -4498, -4888, -5231, -5518, -5760, -5978,
+    -6203, -6464, -6782, -7161, -7588, -8038, -8480, -8887, -9251, -9581, -9907, -10268,
+    -10702, -11222, -11807, -12392, -12867, -13089, -12907, -12186, -10838, -8845, -6270, -3253,
+    0, 3251, 6261, 8827, 10810, 12148, 12863, 13042, 12820, 12348, 11766, 11185,
+    10667, 10235, 9873, 9546, 9215, 8851, 8445, 8006, 7559, 7135, 6758, 6441,
+    6178, 5951, 5730, 5485, 5197, 4856, 4469, 4056, 3641, 3248, 2890, 2568,
+    2270, 1975, 1660, 1307, 907, 465, 0, -465, -906, -1306, -1659, -1973,
+    -2268, -2565, -2887, -3244, -3636, -4048, -4458, -4842, -5181, -5469, -5712, -5933,
+    -6161, -6423, -6738, -7111, -7530, -7970, -8402, -8802, -9160, -9487, -9810, -10166,
+    -10588, -11088, -11646, -12197, -12635, -12825, -12621, -11895, -10565, -8613, -6100, -3164,
+    0, 3162, 6093, 8598, 10541, 11864, 12584, 12785, 12596, 12159, 11612, 11057,
+    10558, 10137, 9781, 9458, 9130, 8771, 8372, 7942, 7505, 7089, 6718, 6403,
+    6140, 5910, 5686, 5440, 5153, 4815, 4434, 4027, 3619, 3230, 2875, 2553,
+    2254, 1958, 1643, 1291, 894, 458, 0, -458, -893, -1290, -1641, -1956,
+    -2252, -2551, -2872, -3227, -3614, -4020, -4424, -4803, -5139, -5426, -5671, -5895,
+    -6125, -6387, -6700, -7068, -7480, -7911, -8335, -8729, -9084, -9408, -9728, -10079,
+    -10491, -10975, -11510, -12033, -12441, -12603, -12381, -11651, -10336, -8418, -5959, -3089,
+    0, 3088, 5953, 8406, 10316, 11625, 12350, 12570, 12408, 12001, 11481, 10949,
+    10466, 10055, 9704, 9383, 9058, 8703, 8310, 7888, 7459, 7049, 6683, 6370,
+    6107, 5875, 5649, 5402, 5115, 4780, 4403, 4002, 3599, 3215, 2861, 2540,
+    2241, 1944, 1628, 1277, 883, 453, 0, -453, -883, -1276, -1627, -1942,
+    -2239, -2538, -2859, -3212, -3595, -3996, -4396, -4770, -5104, -5390, -5636, -5862,
+    -6094, -6357, -6668, -7032, -7437, -7862, -8279, -8668, -9019, -9341, -9659, -10006,
+    -10410, -10881, -11397, -11896, -12279, -12420, -12183, -11450, -10147, -8258, -5842, -3028,
+    0, 3026, 5837, 8247, 10130, 11429, 12157, 12392, 12252, 11870, 11373, 10859,
+    10389, 9986, 9639, 9320, 8997, 8646, 8258, 7842, 7420, 7016, 6654, 6343,
+    6079, 5846, 5618, 5370, 5084, 4751, 4378, 3981, 3583, 3202, 2850, 2530,
+    2230, 1932, 1616, 1266, 875, 448, 0, -448, -874, -1265, -1615, -1930,
+    -2228, -2528, -2848, -3199, -3579, -3977, -4372, -4743, -5075, -5360, -5608, -5835,
+    -6069, -6332, -6642, -7002, -7402, -7821, -8233, -8618, -8966, -9286, -9603, -9946,
+    -10343, -10803, -11304, -11784, -12148, -12270, -12021, -11286, -9993, -8127, -5747, -2978,
+    0, 2977, 5743, 8119, 9980, 11269, 12001, 12248, 12126, 11763, 11285, 10786,
+    10327, 9930, 9586, 9269, 8948, 8600, 8216, 7805, 7388, 6989, 6630, 6320,
+    6056, 5822, 5593, 5344, 5058, 4727, 4358, 3965, 3569, 3191, 2841, 2521,
+    2220, 1922, 1606, 1257, 868, 444, 0, -444, -868, -1256, -1605, -1921,
+    -2219, -2520, -2840, -3189, -3567, -3961, -4352, -4721, -5051, -5336, -5584, -5813,
+    -6048, -6311, -6620, -6977, -7374, -7788, -8196, -8577, -8923, -9242, -9557, -9898,
+    -10290, -10741, -11230, -11695, -12042, -12151, -11892, -11156, -9870, -8023, -5671, -2938,
+    0, 2937, 5668, 8017, 9860, 11142, 11876, 12133, 12025, 11679, 11214, 10727,
+    10277, 9885, 9544, 9229, 8909, 8563, 8182, 7776, 7362, 6967, 6610, 6302,
+    6038, 5803, 5573, 5324, 5038, 4709, 4341, 3951, 3559, 3182, 2834, 2514,
+    2213, 1914, 1598, 1249, 862, 441, 0, -441, -862, -1249, -1597, -1913,
+    -2212, -2513, -2833, -3181, -3556, -3948, -4337, -4704, -5032, -5317, -5566, -5796,
+    -6031, -6295, -6603, -6958, -7351, -7762, -8167, -8545, -8889, -9207, -9521, -9860,
+    -10248, -10693, -11172, -11625, -11960, -12058, -11792, -11055, -9775, -7943, -5613, -2907,
+    0, 2907, 5610, 7938, 9768, 11044, 11780, 12045, 11947, 11613, 11160, 10682,
+    10238, 9850, 9511, 9197, 8879, 8534, 8156, 7753, 7343, 6950, 6595, 6288,
+    6024, 5788, 5557, 5308, 5022, 4694, 4329, 3941, 3550, 3176, 2828, 2509,
+    2207, 1908, 1592, 1244, 858, 439, 0, -439, -858, -1244, -1591, -1907,
+    -2207, -2508, -2827, -3175, -3549, -3938, -4326, -4690, -5018, -5303, -5552, -5783,
+    -6019, -6283, -6590, -6943, -7334, -7743, -8145, -8521, -8864, -9181, -9494, -9831,
+    -10216, -10656, -11128, -11573, -11899, -11988, -11717, -10979, -9704, -7883, -5569, -2884,
+    0, 2884, 5567, 7879, 9699, 10971, 11708, 11978, 11889, 11564, 11119, 10648,
+    10209, 9824, 9487, 9174, 8856, 8513, 8137, 7736, 7328, 6938, 6584, 6277,
+    6013, 5777, 5545, 5296, 5011, 4683, 4319, 3933, 3544, 3171, 2824, 2505,
+    2203, 1904, 1587, 1240, 855, 437, 0, -437, -855, -1240, -1587, -1903,
+    -2203, -2504, -2823, -3170, -3543, -3931, -4317, -4681, -5007, -5292, -5542, -5773,
+    -6010, -6274, -6580, -6933, -7322, -7728, -8128, -8503, -8845, -9162, -9474, -9810,
+    -10193, -10630, -11096, -11535, -11855, -11938, -11663, -10924, -9653, -7839, -5538, -2868,
+    0, 2868, 5537, 7837, 9649, 10919, 11657, 11931, 11848, 11529, 11090, 10624,
+    10188, 9805, 9469, 9157, 8840, 8498, 8123, 7723, 7318, 6929, 6576, 6270,
+    6006, 5769, 5537, 5287, 5002, 4676, 4313, 3928, 3540, 3167, 2821, 2502,
+    2200, 1901, 1584, 1237, 853, 436, 0, -436, -853, -1237, -1584, -1900,
+    -2200, -2501, -2821, -3167, -3539, -3926, -4311, -4674, -5000, -5285, -5535, -5767,
+    -6003, -6267, -6574, -6925, -7314, -7719, -8117, -8491, -8833, -9149, -9461, -9796,
+    -10178, -10612, -11075, -11510, -11825, -11904, -11627, -10888, -9619, -7810, -5517, -2857,
+    0, 2857, 5516, 7809, 9617, 10884, 11623, 11900, 11820, 11506, 11071, 10608,
+    10175, 9793, 9458, 9146, 8829, 8488, 8114, 7715, 7311, 6923, 6571, 6265,
+    6001, 5764, 5532, 5282, 4997, 4671, 4308, 3924, 3537, 3165, 2819, 2500,
+    2199, 1899, 1582, 1235, 851, 435, 0, -435, -851, -1235, -1582, -1898,
+    -2198, -2500, -2819, -3165, -3537, -3923, -4307, -4670, -4996, -5280, -5530, -5763,
+    -6000, -6263, -6569, -6921, -7308, -7712, -8111, -8484, -8825, -9141, -9453, -9788,
+    -10168, -10601, -11062, -11494, -11806, -11884, -11605, -10865, -9598, -7793, -5504, -2850,
+    0, 2850, 5504, 7792, 9597, 10863, 11603, 11881, 11804, 11492, 11060, 10599,
+    10166, 9786, 9451, 9139, 8823, 8482, 8109, 7711, 7307, 6919, 6568, 6262,
+    5998, 5761, 5529, 5279, 4994, 4668, 4306, 3922, 3535, 3164, 2818, 2499,
+    2197, 1897, 1581, 1234, 851, 435, 0, -435, -851, -1234, -1581, -1897,
+    -2197, -2499, -2818, -3164, -3535, -3922, -4305, -4667, -4993, -5278, -5528, -5760,
+    -5997, -6261, -6567, -6918, -7305, -7709, -8107, -8480, -8821, -9137, -9448, -9783,
+    -10163, -10595, -11055, -11486, -11797, -11873, -11593, -10854, -9587, -7784, -5497, -2847,
+    0, 2847, 5497, 7783, 9587, 10853, 11592, 11872, 11796, 11485, 11054, 10594,
+    10162, 9782, 9448, 9136, 8820, 8479, 8106, 7708, 7305, 6918, 6567, 6261,
+    5997, 5760, 5527, 5277, 4992, 4667, 4305, 3921, 3535, 3163, 2818, 2499,
+    2197, 1897, 1581, 1234, 850, 435, 0, -435, -850, -1234, -1581, -1897,
+    -2197, -2498, -2818, -3163, -3535, -3921, -4305, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9447, -9781,
+    -10161, -10593, -11052, -11483, -11793, -11869, -11589, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11589, 11868, 11793, 11483, 11052, 10592,
+    10161, 9781, 9447, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845,
+    0, 2845, 5495, 7780, 9583, 10849, 11588, 11868, 11792, 11482, 11052, 10592,
+    10161, 9781, 9446, 9135, 8819, 8478, 8105, 7708, 7304, 6917, 6566, 6260,
+    5996, 5759, 5527, 5277, 4992, 4666, 4304, 3921, 3535, 3163, 2817, 2498,
+    2197, 1897, 1580, 1234, 850, 434, 0, -434, -850, -1234, -1580, -1897,
+    -2197, -2498, -2817, -3163, -3535, -3921, -4304, -4666, -4992, -5277, -5527, -5759,
+    -5996, -6260, -6566, -6917, -7304, -7708, -8105, -8478, -8819, -9135, -9446, -9781,
+    -10161, -10592, -11052, -11482, -11792, -11868, -11588, -10849, -9583, -7780, -5495, -2845
+};
+
+const SampleData keysSample =
+{
+    0,
+    keysSampleData,
+    4200,
+    2520,
+    4200,
+    22050.0f,
+    262.5000f
+};
@@ -0,0 +1,7 @@
+// Generated by WaveToSample from Keys.wav, don't edit by hand
+
+#pragma once
+
+#include "AudioGeneration/SampleData.h"
+
+extern const SampleData keysSample;
@@ -0,0 +1,145 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/StateVariableFilter.h"
+#include "AudioGeneration/FilterCutoffTable.h"
+
+StateVariableFilter::StateVariableFilter() :
+    mode_(Bypass),
+    cutoff_(MAX_CUTOFF),
+    resonance_(0),
+    a1_(0.0f),
+    a2_(0.0f),
+    a3_(0.0f),
+    inputMix_(1.0f),
+    bandMix_(0.0f),
+    lowMix_(0.0f),
+    ic1eq_(0.0f),
+    ic2eq_(0.0f) { }
+
+FilterMode StateVariableFilter::GetMode()
+{
+    return mode_;
+}
+
+uint8_t StateVariableFilter::GetCutoff()
+{
+    return cutoff_;
+}
+
+uint8_t StateVariableFilter::GetResonance()
+{
+    return resonance_;
+}
+
+void StateVariableFilter::SetMode(FilterMode mode)
+{
+    mode_ = mode;
+}
+
+void StateVariableFilter::SetCutoff(uint8_t cutoff)
+{
+    cutoff_ = (cutoff > MAX_CUTOFF) ? MAX_CUTOFF : cutoff;
+}
+
+void StateVariableFilter::SetResonance(uint8_t resonance)
+{
+    resonance_ = (resonance > MAX_RESONANCE) ? MAX_RESONANCE : resonance;
+}
+
+void StateVariableFilter::UpdateCoefficients(float cutoffModulation)
+{
+    float g = GetFilterCutoffCoefficient(static_cast<float>(cutoff_) + cutoffModulation);
+
+    // k is the damping (1/Q).  A resonance of zero gives a Q of 0.5 (no peak at all) and the max
+    // resonance gives a Q of 10, which rings nicely without quite self-oscillating.
+    float k = 2.0f - 0.19f * static_cast<float>(resonance_);
+
+    a1_ = 1.0f / (1.0f + g * (g + k));
+    a2_ = g * a1_;
+    a3_ = g * a2_;
+
+    // Rather than branching on the mode for every sample, the output is always calculated as a
+    // mix of the input, band pass and low pass signals.  (High pass = input - k*band - low).
+    switch(mode_)
+    {
+        case LowPass:
+            inputMix_ = 0.0f;
+            bandMix_ = 0.0f;
+            lowMix_ = 1.0f;
+            break;
+        case BandPass:
+            inputMix_ = 0.0f;
+            bandMix_ = 1.0f;
+            lowMix_ = 0.0f;
+            break;
+        case HighPass:
+            inputMix_ = 1.0f;
+            bandMix_ = -k;
+            lowMix_ = -1.0f;
+            break;
+        case Bypass:
+            inputMix_ = 1.0f;
+            bandMix_ = 0.0f;
+            lowMix_ = 0.0f;
+            break;
+    }
+}
+
+void StateVariableFilter::Process(float buffer[], uint32_t bufferSampleSize)
+{
+    // Work on local copies so the compiler can keep everything in FPU registers.  Each line in
+    // the loop below maps onto one or two fused multiply-adds (VFMA) on the M4F.
+    const float a1 = a1_;
+    const float a2 = a2_;
+    const float a3 = a3_;
+    const float inputMix = inputMix_;
+    const float bandMix = bandMix_;
+    const float lowMix = lowMix_;
+    float ic1eq = ic1eq_;
+    float ic2eq = ic2eq_;
+
+    for(uint32_t i = 0; i < bufferSampleSize; ++i)
+    {
+        float v0 = buffer[i];
+        float v3 = v0 - ic2eq;
+        float v1 = a1 * ic1eq + a2 * v3;
+        float v2 = ic2eq + a2 * ic1eq + a3 * v3;
+        ic1eq = 2.0f * v1 - ic1eq;
+        ic2eq = 2.0f * v2 - ic2eq;
+
+        buffer[i] = inputMix * v0 + bandMix * v1 + lowMix * v2;
+    }
+
+    ic1eq_ = ic1eq;
+    ic2eq_ = ic2eq;
+}
+
+void StateVariableFilter::Reset()
+{
+    ic1eq_ = 0.0f;
+    ic2eq_ = 0.0f;
+}
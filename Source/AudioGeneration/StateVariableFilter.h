@@ -0,0 +1,73 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "AudioGeneration/FilterModes.h"
+
+// A resonant 2-pole state variable filter based on Andrew Simper's trapezoidal integrated SVF
+// (see https://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf).  The coefficients are only
+// recalculated in UpdateCoefficients, which the mixer calls once per control block, so the
+// per-sample work in Process is just a handful of multiply-adds.
+class StateVariableFilter
+{
+    public:
+        StateVariableFilter();
+
+        FilterMode GetMode();
+        uint8_t GetCutoff();
+        uint8_t GetResonance();
+
+        void SetMode(FilterMode mode);
+        void SetCutoff(uint8_t cutoff);
+        void SetResonance(uint8_t resonance);
+
+        // The cutoff modulation is added to the cutoff (so it's in the same 0-to-127 units)
+        void UpdateCoefficients(float cutoffModulation);
+        void Process(float buffer[], uint32_t bufferSampleSize);
+        void Reset();
+
+        static const uint8_t MAX_CUTOFF = 127;
+        static const uint8_t MAX_RESONANCE = 10;
+
+    private:
+        FilterMode mode_;
+        uint8_t cutoff_;
+        uint8_t resonance_;
+
+        // Coefficients (recalculated at control rate)
+        float a1_;
+        float a2_;
+        float a3_;
+        float inputMix_;
+        float bandMix_;
+        float lowMix_;
+
+        // Filter state (the two integrator capacitors)
+        float ic1eq_;
+        float ic2eq_;
+};
@@ -0,0 +1,196 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "AudioGeneration/Tuning.h"
+#include "AudioGeneration/NoteFrequencyTable.h"
+#include "AudioGeneration/AudioSettings.h"
+#include <math.h>
+
+// The note the reference pitch applies to and the pitch the equal tempered note table has it at
+const uint8_t referenceNoteIndex = 57;
+const float equalTemperamentReference = 440.0f;
+
+// Each pitch class's offset from equal temperament in cents, from C up to B.  Just intonation is
+// the usual 5-limit scale, and meantone is quarter comma meantone with the wolf fifth between G#
+// and Eb.
+const uint8_t pitchClassCount = 12;
+const float scaleOffsets[][pitchClassCount] =
+{
+    { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },
+    { 0.0f, 11.73f, 3.91f, 15.64f, -13.69f, -1.96f, -9.78f, 1.96f, 13.69f, -15.64f, 17.60f, -11.73f },
+    { 0.0f, 13.69f, 3.91f, -5.87f, 7.82f, -1.96f, 11.73f, 1.96f, 15.64f, 5.87f, -3.91f, 9.78f },
+    { 0.0f, -23.95f, -6.84f, 10.26f, -13.69f, 3.42f, -20.53f, -3.42f, -27.37f, -10.26f, 6.84f, -17.11f }
+};
+
+// A MIDI Tuning Standard frequency is a note number, in standard MIDI numbering, plus a 14 bit
+// fraction of a semitone.  7F 7F 7F means "leave this note alone".  The keys being retuned are in
+// standard MIDI numbering too, which puts A440 an octave above the synth's referenceNoteIndex.
+const uint8_t mtsA440Note = 69;
+const float mtsFractionScale = 1.0f / 16384.0f;
+const uint8_t mtsNoChange = 0x7F;
+const uint32_t mtsBytesPerNote = 4;
+
+Tuning::Tuning() :
+    scale_(EQUAL),
+    referencePitch_(DEFAULT_REFERENCE_PITCH),
+    activeTable_(tables_[0]),
+    changeCount_(0)
+{
+    // The table's built from the equal tempered one
+    InitializeNoteFrequencyTable();
+    BuildTable();
+}
+
+Tuning::Scale Tuning::GetScale()
+{
+    return scale_;
+}
+
+uint16_t Tuning::GetReferencePitch()
+{
+    return referencePitch_;
+}
+
+void Tuning::SetScale(Scale scale)
+{
+    scale_ = scale;
+    BuildTable();
+}
+
+void Tuning::SetReferencePitch(uint16_t referencePitch)
+{
+    if(referencePitch < MIN_REFERENCE_PITCH) { referencePitch_ = MIN_REFERENCE_PITCH; }
+    else if(referencePitch > MAX_REFERENCE_PITCH) { referencePitch_ = MAX_REFERENCE_PITCH; }
+    else { referencePitch_ = referencePitch; }
+
+    BuildTable();
+}
+
+void Tuning::SetNoteFrequency(uint8_t noteIndex, float frequency)
+{
+    if(noteIndex >= NOTE_COUNT || frequency <= 0.0f)
+    {
+        return;
+    }
+
+    // A single float write, so the audio interrupt sees either the old cycle length or the new one
+    activeTable_[noteIndex] = SAMPLE_RATE / frequency;
+    ++changeCount_;
+}
+
+bool Tuning::HandleSysEx(const uint8_t message[], uint32_t messageSize)
+{
+    // F0 7F <device> 08 02 <program> <count> [<note> <xx> <yy> <zz>] ... F7, or for the bank select
+    // version F0 7E/7F <device> 08 07 <bank> <program> <count> ...
+    if(messageSize < 8 || message[0] != 0xF0 || message[messageSize - 1] != 0xF7 || message[3] != 0x08)
+    {
+        return false;
+    }
+
+    uint32_t countIndex;
+    if(message[1] == 0x7F && message[4] == 0x02) { countIndex = 6; }
+    else if((message[1] == 0x7E || message[1] == 0x7F) && message[4] == 0x07) { countIndex = 7; }
+    else { return false; }
+
+    uint32_t noteCount = message[countIndex];
+    if(messageSize != countIndex + 1 + noteCount * mtsBytesPerNote + 1)
+    {
+        return false;
+    }
+
+    for(uint32_t i = 0; i < noteCount; ++i)
+    {
+        const uint8_t* change = &(message[countIndex + 1 + i * mtsBytesPerNote]);
+        if(change[1] == mtsNoChange && change[2] == mtsNoChange && change[3] == mtsNoChange)
+        {
+            continue;
+        }
+
+        // A key below the synth's lowest note is left out
+        if(change[0] < mtsA440Note - referenceNoteIndex)
+        {
+            continue;
+        }
+
+        uint8_t noteIndex = change[0] - (mtsA440Note - referenceNoteIndex);
+        float fraction = static_cast<float>((change[2] << 7) | change[3]) * mtsFractionScale;
+        float semitones = static_cast<float>(change[1] - mtsA440Note) + fraction;
+        SetNoteFrequency(noteIndex, equalTemperamentReference * powf(2.0f, semitones / 12.0f));
+    }
+
+    return true;
+}
+
+float Tuning::GetSamplesPerCycle(uint8_t noteIndex)
+{
+    if(noteIndex >= NOTE_COUNT)
+    {
+        return 0.0f;
+    }
+
+    return activeTable_[noteIndex];
+}
+
+float Tuning::GetFrequency(uint8_t noteIndex)
+{
+    if(noteIndex >= NOTE_COUNT)
+    {
+        return 0.0f;
+    }
+
+    return SAMPLE_RATE / activeTable_[noteIndex];
+}
+
+uint32_t Tuning::GetChangeCount()
+{
+    return changeCount_;
+}
+
+void Tuning::BuildTable()
+{
+    float* table = (activeTable_ == tables_[0]) ? tables_[1] : tables_[0];
+
+    const float* offsets = scaleOffsets[scale_];
+    float referenceOffset = offsets[referenceNoteIndex % pitchClassCount];
+    float referenceRatio = static_cast<float>(referencePitch_) / equalTemperamentReference;
+
+    for(uint8_t i = 0; i < NOTE_COUNT; ++i)
+    {
+        float frequency = ::GetFrequency(i) * referenceRatio;
+
+        // Equal temperament's left exactly as the note table has it
+        float cents = offsets[i % pitchClassCount] - referenceOffset;
+        if(cents != 0.0f)
+        {
+            frequency *= powf(2.0f, cents / 1200.0f);
+        }
+
+        table[i] = SAMPLE_RATE / frequency;
+    }
+
+    activeTable_ = table;
+    ++changeCount_;
+}
@@ -0,0 +1,93 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// The tuning the oscillators look their notes up in.  It's set by a scale and the pitch of the A
+// that plays 440 Hz in equal temperament (note 57).  The scale gives each pitch class's offset from
+// equal temperament, starting from C, and is shifted so that A stays at the reference pitch.  Single
+// notes can also be retuned with MIDI Tuning Standard SysEx messages.
+//
+// The table holds each note's cycle length in samples.  It's worked out whenever the tuning changes,
+// so the audio code only ever looks a note up.  A new scale or reference pitch is built in a second
+// table and then swapped in with a single pointer write.  The Cortex-M4 does that write atomically,
+// so the audio interrupt always sees one complete table or the other.
+class Tuning
+{
+    public:
+        enum Scale
+        {
+            EQUAL,
+            JUST,
+            PYTHAGOREAN,
+            MEANTONE
+        };
+
+        static const uint8_t NOTE_COUNT = 128;
+
+        // The reference pitch is in Hz
+        static const uint16_t MIN_REFERENCE_PITCH = 415;
+        static const uint16_t MAX_REFERENCE_PITCH = 466;
+        static const uint16_t DEFAULT_REFERENCE_PITCH = 440;
+
+        Tuning();
+
+        Scale GetScale();
+        uint16_t GetReferencePitch();
+
+        // Both rebuild the whole table, which undoes any notes retuned by SysEx
+        void SetScale(Scale scale);
+        void SetReferencePitch(uint16_t referencePitch);
+
+        // Retunes one note of the current table in place
+        void SetNoteFrequency(uint8_t noteIndex, float frequency);
+
+        // Applies a MIDI Tuning Standard single note tuning change.  Both the real time message and
+        // the "with bank select" one (real time or not) are understood, whatever their device ID,
+        // tuning program and bank.  The message runs from the 0xF0 to the 0xF7.  Returns false for
+        // anything else, leaving the tuning as it was.
+        bool HandleSysEx(const uint8_t message[], uint32_t messageSize);
+
+        // The note's cycle length in samples at SAMPLE_RATE, and its frequency.  Both are zero for an
+        // out of range note.
+        float GetSamplesPerCycle(uint8_t noteIndex);
+        float GetFrequency(uint8_t noteIndex);
+
+        // Goes up each time the table changes, so the oscillators know to look their notes up again
+        uint32_t GetChangeCount();
+
+    private:
+        void BuildTable();
+
+        Scale scale_;
+        uint16_t referencePitch_;
+
+        float tables_[2][NOTE_COUNT];
+        float* volatile activeTable_;
+        volatile uint32_t changeCount_;
+};
@@ -30,5 +30,8 @@ enum WaveformType
 {
     None,
     Square,
-    Sawtooth
+    Sawtooth,
+    Noise,
+    PinkNoise,
+    Sample
 };
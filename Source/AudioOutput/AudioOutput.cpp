@@ -30,6 +30,19 @@
 
 #define AUDIO_BUFFER_SIZE_IN_SAMPLES  256
 
+// The SSI clock divisor and the number of bits (i.e. clocks) sent per sample (see InitSSI0)
+#define SSI_CLOCK_DIVISOR  113
+#define SSI_BITS_PER_SAMPLE  16
+#define CYCLES_PER_AUDIO_BUFFER  (AUDIO_BUFFER_SIZE_IN_SAMPLES * SSI_CLOCK_DIVISOR * SSI_BITS_PER_SAMPLE)
+
+// The Cortex-M4's debug cycle counter (see the ARMv7-M Architecture Reference Manual, C1.8).  It
+// counts system clock cycles, which makes it a cheap way to time the audio callback.
+#define CORE_DEMCR_R  (*((volatile uint32_t*)0xE000EDFC))
+#define CORE_DEMCR_TRCENA  (1 << 24)
+#define DWT_CONTROL_R  (*((volatile uint32_t*)0xE0001000))
+#define DWT_CONTROL_CYCCNTENA  (1 << 0)
+#define DWT_CYCLE_COUNT_R  (*((volatile uint32_t*)0xE0001004))
+
 extern "C" void SSI0InterruptHandler();
 
 uint16_t primaryAudioBuffer[AUDIO_BUFFER_SIZE_IN_SAMPLES];
@@ -38,17 +51,37 @@ uint16_t alternateAudioBuffer[AUDIO_BUFFER_SIZE_IN_SAMPLES];
 // The callback function for getting audio data
 void (*fillAudioBufferCallback)(uint16_t* buffer, uint32_t bufferSampleSize);
 
+volatile uint32_t peakFillCycles = 0;
+
 // Function prototypes
 void InitSSI0();
 void ConfigureAudioOutputDMA();
 void ConfigureChannelControlStructure(uint32_t channel, enum ChannelType channelType);
+void InitCycleCounter();
+void FillAudioBuffer(uint16_t* buffer);
 
 void InitAudioOutput(void (*callback)(uint16_t* buffer, uint32_t bufferSampleSize))
 {
     fillAudioBufferCallback = callback;
+    InitCycleCounter();
     InitSSI0();
 }
 
+void InitCycleCounter()
+{
+    CORE_DEMCR_R |= CORE_DEMCR_TRCENA;
+    DWT_CYCLE_COUNT_R = 0;
+    DWT_CONTROL_R |= DWT_CONTROL_CYCCNTENA;
+}
+
+uint32_t GetAudioOutputPeakLoad()
+{
+    uint32_t cycles = peakFillCycles;
+    peakFillCycles = 0;
+
+    return (cycles * 100) / CYCLES_PER_AUDIO_BUFFER;
+}
+
 // We're going to use SSI0 for communication with the MAX541 DAC.  SSI0 corresponds to pins
 // PA2-thru-PA5 (see page 1351):
 //    PA2: SSI0Clk
@@ -253,17 +286,30 @@ void ConfigureAudioOutputDMA()
     EnableDMAChannel(11);
 }
 
+void FillAudioBuffer(uint16_t* buffer)
+{
+    uint32_t startCycle = DWT_CYCLE_COUNT_R;
+    fillAudioBufferCallback(buffer, AUDIO_BUFFER_SIZE_IN_SAMPLES);
+
+    // The counter wraps every 53 seconds at 80 MHz, which the unsigned subtraction takes care of
+    uint32_t cycles = DWT_CYCLE_COUNT_R - startCycle;
+    if(cycles > peakFillCycles)
+    {
+        peakFillCycles = cycles;
+    }
+}
+
 void SSI0InterruptHandler()
 {
     if(CheckForTranferCompletion(11, PRIMARY))
     {
-        fillAudioBufferCallback(primaryAudioBuffer, AUDIO_BUFFER_SIZE_IN_SAMPLES);
+        FillAudioBuffer(primaryAudioBuffer);
         ReSetChannelControlStructureModeAndSize(11, PRIMARY, 0x03, AUDIO_BUFFER_SIZE_IN_SAMPLES);
     }
 
     if(CheckForTranferCompletion(11, ALTERNATE))
     {
-        fillAudioBufferCallback(alternateAudioBuffer, AUDIO_BUFFER_SIZE_IN_SAMPLES);
+        FillAudioBuffer(alternateAudioBuffer);
         ReSetChannelControlStructureModeAndSize(11, ALTERNATE, 0x03, AUDIO_BUFFER_SIZE_IN_SAMPLES);
     }
 
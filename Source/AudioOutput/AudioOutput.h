@@ -29,3 +29,8 @@
 #include <stdint.h>
 
 void InitAudioOutput(void (*callback)(uint16_t* buffer, uint32_t bufferSampleSize));
+
+// The longest any call to the callback has taken since this was last called, as a percentage of
+// the time the DAC takes to play one buffer (i.e. how close audio generation is to running out
+// of time).
+uint32_t GetAudioOutputPeakLoad();
@@ -63,6 +63,11 @@ void LCD::WriteText(const char* text)
 }
 
 void LCD::WriteChar(uint8_t row, uint8_t column, char theChar)
+{
+    WriteChars(row, column, &theChar, 1);
+}
+
+void LCD::WriteChars(uint8_t row, uint8_t column, const char* chars, uint8_t count)
 {
     // To understand what we're doing here with "baseDDRAMAddress" see pg 10 of the
     // NHD-0420H1Z-FL-GBW-33V3 datasheet.
@@ -78,8 +83,15 @@ void LCD::WriteChar(uint8_t row, uint8_t column, char theChar)
     // 0010.0001 = 0x21  <-- Set DDRAM to row=0, column=1
     fifo_.Push(LCDAction(LCDAction::Command, command));
     fifo_.Push(LCDAction(LCDAction::Wait, 4));
-    fifo_.Push(LCDAction(LCDAction::Write, theChar));
-    fifo_.Push(LCDAction(LCDAction::Wait, 4));
+
+    // DatasheetInit sets the entry mode to 0x06, so after each write the display moves the
+    // DDRAM address on by one itself.  Each row's 20 addresses are contiguous, so there's no
+    // need to set the address again before the next char.
+    for(uint8_t i = 0; i < count; ++i)
+    {
+        fifo_.Push(LCDAction(LCDAction::Write, chars[i]));
+        fifo_.Push(LCDAction(LCDAction::Wait, 4));
+    }
 }
 
 void LCD::Process(uint64_t ticks)
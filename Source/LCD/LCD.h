@@ -51,6 +51,11 @@ class LCD
         void WriteText(const char*);
         void WriteChar(uint8_t row, uint8_t column, char theChar);
 
+        // Writes count chars starting at the given row/column, setting the DDRAM address just once
+        // and letting the display's auto-increment move along the row for the rest.  The chars must
+        // all fit on the one row.
+        void WriteChars(uint8_t row, uint8_t column, const char* chars, uint8_t count);
+
         void ClearScreenBlocking();
         void WriteTextBlocking(const char*);
         void WriteCharBlocking(uint8_t row, uint8_t column, char theChar);
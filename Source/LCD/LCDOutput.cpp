@@ -48,24 +48,43 @@ void LCDOutput::Process(uint64_t ticks)
 
 void LCDOutput::SetText(uint8_t line, const char* text)
 {
-    uint8_t columnCounter = 0;
-    while(text[columnCounter])
+    // Only the chars that changed are sent to the display, and each run of them next to one
+    // another is sent as one write (one DDRAM address command, then the chars).  A column whose
+    // char is the same as before ends the run, as restarting one later costs the display no more
+    // than rewriting that char would.
+    uint8_t runStart = COLUMNS_;
+    bool textEnded = false;
+    for(uint8_t column = 0; column < COLUMNS_; ++column)
     {
-        if(existingText_[line][columnCounter] != text[columnCounter])
+        if(!textEnded && text[column] == 0)
         {
-            lcd_.WriteChar(line, columnCounter, text[columnCounter]);
-            existingText_[line][columnCounter] = text[columnCounter];
+            textEnded = true;
         }
-        ++columnCounter;
-    }
 
-    while(columnCounter < COLUMNS_)
-    {
-        if(existingText_[line][columnCounter] != ' ')
+        char newChar = textEnded ? ' ' : text[column];
+        if(existingText_[line][column] != newChar)
         {
-            lcd_.WriteChar(line, columnCounter, ' ');
-            existingText_[line][columnCounter] = ' ';
+            existingText_[line][column] = newChar;
+            if(runStart == COLUMNS_)
+            {
+                runStart = column;
+            }
         }
-        ++columnCounter;
+        else if(runStart != COLUMNS_)
+        {
+            WriteRun(line, runStart, column);
+            runStart = COLUMNS_;
+        }
+    }
+
+    if(runStart != COLUMNS_)
+    {
+        WriteRun(line, runStart, COLUMNS_);
     }
 }
+
+void LCDOutput::WriteRun(uint8_t line, uint8_t startColumn, uint8_t endColumn)
+{
+    // existingText_ already holds the new chars by the time a run is written
+    lcd_.WriteChars(line, startColumn, &existingText_[line][startColumn], endColumn - startColumn);
+}
@@ -44,6 +44,8 @@ class LCDOutput : public MenuOutput
         void Process(uint64_t ticks);
 
     private:
+        void WriteRun(uint8_t line, uint8_t startColumn, uint8_t endColumn);
+
         LCD lcd_;
         char existingText_[ROWS_][COLUMNS_];
 };
@@ -0,0 +1,226 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "MIDI/MIDIParser.h"
+
+MIDIParser::MIDIParser() :
+    callCount_(0),
+    message_(NO_MESSAGE),
+    dataByteCount_(0),
+    dataBytesReceived_(0),
+    firstDataByte_(0),
+    sysExInputSize_(0),
+    sysExInputOverflow_(false),
+    receivingSysEx_(false),
+    sysExMessageSize_(0)
+{
+    for(uint8_t i = 0; i < NOTE_COUNT; ++i)
+    {
+        noteMapping_[i] = 0;
+    }
+}
+
+void MIDIParser::ReleaseAllNotes()
+{
+    for(uint8_t i = 0; i < NOTE_COUNT; ++i)
+    {
+        noteMapping_[i] = 0;
+    }
+
+    ++callCount_;
+}
+
+uint8_t MIDIParser::GetMostRecentKey()
+{
+    uint32_t maxCallCount = 0;
+    uint8_t lastKeyPressed = 0;
+
+    for(uint8_t i = 0; i < NOTE_COUNT; ++i)
+    {
+        if(noteMapping_[i] > maxCallCount)
+        {
+            lastKeyPressed = i;
+            maxCallCount = noteMapping_[i];
+        }
+    }
+
+    return lastKeyPressed;
+}
+
+bool MIDIParser::GetNoteHeld(uint8_t note)
+{
+    return note < NOTE_COUNT && noteMapping_[note] != 0;
+}
+
+uint32_t MIDIParser::GetCallCount()
+{
+    return callCount_;
+}
+
+uint32_t MIDIParser::GetSysExMessage(uint8_t* message, uint32_t maxMessageSize)
+{
+    uint32_t messageSize = sysExMessageSize_;
+    if(messageSize == 0)
+    {
+        return 0;
+    }
+
+    if(messageSize > maxMessageSize)
+    {
+        messageSize = 0;
+    }
+
+    for(uint32_t i = 0; i < messageSize; ++i)
+    {
+        message[i] = sysExMessage_[i];
+    }
+
+    sysExMessageSize_ = 0;  // Lets the receiver store the next message
+    return messageSize;
+}
+
+// Check out a MIDI specification to understand the commands and the sequence of commands.
+// Just search for "MIDI specification" and you will find a lot of great online resources.
+void MIDIParser::HandleByte(uint8_t midiByte)
+{
+    // Real time messages (clock, start, stop, active sensing, etc) can turn up anywhere, even in
+    // the middle of another message, and don't affect it
+    if(midiByte >= 0xF8)
+    {
+        return;
+    }
+
+    // A SysEx message carries on until its 0xF7, but any other status byte cuts it short
+    if(midiByte == 0xF0)
+    {
+        receivingSysEx_ = true;
+        sysExInputSize_ = 0;
+        sysExInputOverflow_ = false;
+        message_ = NO_MESSAGE;
+    }
+
+    if(receivingSysEx_)
+    {
+        if(midiByte < 0x80 || midiByte == 0xF0 || midiByte == 0xF7)
+        {
+            HandleSysExByte(midiByte);
+            return;
+        }
+
+        receivingSysEx_ = false;
+    }
+
+    if(midiByte & 0x80)
+    {
+        HandleStatusByte(midiByte);
+    }
+    else
+    {
+        HandleDataByte(midiByte);
+    }
+}
+
+void MIDIParser::HandleStatusByte(uint8_t midiByte)
+{
+    dataBytesReceived_ = 0;
+
+    switch(midiByte & 0xF0)
+    {
+        case 0x80: message_ = NOTE_OFF_MESSAGE; dataByteCount_ = 2; break;
+        case 0x90: message_ = NOTE_ON_MESSAGE; dataByteCount_ = 2; break;
+        case 0xB0: message_ = CONTROL_CHANGE_MESSAGE; dataByteCount_ = 2; break;
+        case 0xA0: message_ = OTHER_CHANNEL_MESSAGE; dataByteCount_ = 2; break;  // Aftertouch
+        case 0xE0: message_ = OTHER_CHANNEL_MESSAGE; dataByteCount_ = 2; break;  // Pitch bend
+        case 0xC0: message_ = OTHER_CHANNEL_MESSAGE; dataByteCount_ = 1; break;  // Program change
+        case 0xD0: message_ = OTHER_CHANNEL_MESSAGE; dataByteCount_ = 1; break;  // Channel pressure
+
+        // System common messages cancel the running status, and their data bytes are ignored
+        default: message_ = NO_MESSAGE; dataByteCount_ = 0; break;
+    }
+}
+
+void MIDIParser::HandleDataByte(uint8_t midiByte)
+{
+    if(message_ == NO_MESSAGE)
+    {
+        return;
+    }
+
+    ++dataBytesReceived_;
+    if(dataBytesReceived_ == 1)
+    {
+        firstDataByte_ = midiByte;
+    }
+
+    if(dataBytesReceived_ < dataByteCount_)
+    {
+        return;
+    }
+
+    // The message is complete.  Under running status the next data byte starts another one.
+    dataBytesReceived_ = 0;
+
+    if(message_ == NOTE_OFF_MESSAGE || (message_ == NOTE_ON_MESSAGE && midiByte == 0x00))
+    {
+        // A note on with a velocity of 0 means the note is off
+        ++callCount_;
+        noteMapping_[firstDataByte_] = 0;
+    }
+    else if(message_ == NOTE_ON_MESSAGE)
+    {
+        ++callCount_;
+        noteMapping_[firstDataByte_] = callCount_;
+    }
+    else if(message_ == CONTROL_CHANGE_MESSAGE && (firstDataByte_ == ALL_NOTES_OFF_ || firstDataByte_ == ALL_SOUND_OFF_))
+    {
+        ReleaseAllNotes();
+    }
+}
+
+void MIDIParser::HandleSysExByte(uint8_t midiByte)
+{
+    if(sysExInputSize_ < MAX_SYSEX_SIZE)
+    {
+        sysExInput_[sysExInputSize_++] = midiByte;
+    }
+    else
+    {
+        sysExInputOverflow_ = true;
+    }
+
+    if(midiByte == 0xF7)
+    {
+        receivingSysEx_ = false;
+        if(!sysExInputOverflow_ && sysExMessageSize_ == 0)
+        {
+            for(uint32_t i = 0; i < sysExInputSize_; ++i)
+            {
+                sysExMessage_[i] = sysExInput_[i];
+            }
+            sysExMessageSize_ = sysExInputSize_;
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Turns the bytes arriving at the MIDI input into what the synth plays from: which keys are held,
+// which of them was pressed most recently, and the last complete SysEx message.  The receiver
+// feeds it one byte at a time from its interrupt.
+//
+// Note on, note off and the All Notes Off / All Sound Off controllers are understood on every
+// channel, including under running status.  Any other channel message is skipped over.  Real time
+// bytes (clock, active sensing, etc) can come at any point, even in the middle of a message, and
+// are ignored.  A status byte where a data byte was expected abandons the message it interrupts.
+class MIDIParser
+{
+    public:
+        static const uint8_t NOTE_COUNT = 128;
+        static const uint32_t MAX_SYSEX_SIZE = 128;
+
+        MIDIParser();
+
+        void HandleByte(uint8_t midiByte);
+        void ReleaseAllNotes();
+
+        // Returns zero if no key is held
+        uint8_t GetMostRecentKey();
+        bool GetNoteHeld(uint8_t note);
+
+        // Changes whenever a key's pressed or released
+        uint32_t GetCallCount();
+
+        // Copies the last complete SysEx message (from the 0xF0 through to the 0xF7) into the given
+        // buffer and returns its size.  Returns zero if no new message has arrived since the last
+        // call, or if it doesn't fit.
+        uint32_t GetSysExMessage(uint8_t* message, uint32_t maxMessageSize);
+
+    private:
+        enum Message
+        {
+            NO_MESSAGE,
+            NOTE_OFF_MESSAGE,
+            NOTE_ON_MESSAGE,
+            CONTROL_CHANGE_MESSAGE,
+            OTHER_CHANNEL_MESSAGE  // Skipped, but its data bytes still have to be counted
+        };
+
+        static const uint8_t ALL_SOUND_OFF_ = 120;
+        static const uint8_t ALL_NOTES_OFF_ = 123;
+
+        void HandleStatusByte(uint8_t midiByte);
+        void HandleDataByte(uint8_t midiByte);
+        void HandleSysExByte(uint8_t midiByte);
+
+        // Each held key remembers the call count when it was pressed, and zero means it's not held
+        uint32_t noteMapping_[NOTE_COUNT];
+        uint32_t callCount_;
+
+        // The running status, and the data bytes of the message so far
+        Message message_;
+        uint8_t dataByteCount_;  // How many the message needs
+        uint8_t dataBytesReceived_;
+        uint8_t firstDataByte_;
+
+        // A SysEx message is collected in sysExInput_ and then copied to sysExMessage_ once it's
+        // complete.  A non-zero sysExMessageSize_ means there's a message waiting to be picked up,
+        // and any that arrive before it is are dropped.  Messages too long for the buffer are
+        // dropped too.
+        uint8_t sysExInput_[MAX_SYSEX_SIZE];
+        uint32_t sysExInputSize_;
+        bool sysExInputOverflow_;
+        bool receivingSysEx_;
+        uint8_t sysExMessage_[MAX_SYSEX_SIZE];
+        volatile uint32_t sysExMessageSize_;
+};
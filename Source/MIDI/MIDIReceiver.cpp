@@ -25,33 +25,21 @@
  */
 
 #include "MIDI/MIDIReceiver.h"
+#include "MIDI/MIDIParser.h"
 #include "TM4C123G/DMA.h"
 #include "inc/tm4c123gh6pm.h"
 #include <stdint.h>
 
-uint32_t MIDINoteMapping[128];
-uint32_t callCount = 0;
+// Everything received is handed straight to the parser, from the DMA interrupt
+MIDIParser midiParser;
 
 void ConfigureMIDIInputDMA();
-void HandleMIDIMessage(uint8_t midiMessage);
 
 uint8_t primaryMIDIByte = 0;
 uint8_t alternateMIDIByte = 0;
 
-void ClearMIDINoteMapping()
-{
-    volatile uint8_t i = 0;
-
-    for( ; i < 128; ++i)
-    {
-        MIDINoteMapping[i] = 0;
-    }
-}
-
 void InitializeMIDIReceiver()
 {
-    ClearMIDINoteMapping();
-
     /////////////////////////////////////////////////////////////////////////////////////////////////
     // See initialization and configuration steps on page 902.  These are listed below as we
     // step through them.
@@ -205,13 +193,13 @@ extern "C" void MIDIReceiverCallback()
 {
     if(CheckForTranferCompletion(18, PRIMARY))
     {
-        HandleMIDIMessage(primaryMIDIByte);
+        midiParser.HandleByte(primaryMIDIByte);
         ReSetChannelControlStructureModeAndSize(18, PRIMARY, 0x03, 1);
     }
 
     if(CheckForTranferCompletion(18, ALTERNATE))
     {
-        HandleMIDIMessage(alternateMIDIByte);
+        midiParser.HandleByte(alternateMIDIByte);
         ReSetChannelControlStructureModeAndSize(18, ALTERNATE, 0x03, 1);
     }
 
@@ -221,81 +209,15 @@ extern "C" void MIDIReceiverCallback()
 // Returns zero if no key was pressed
 int GetMostRecentMIDIKey()
 {
-    volatile uint8_t i = 0;
-    uint32_t maxCallCount = 0;
-    uint32_t lastKeyPressed = 0;
-
-    for( ; i < 128; ++i)
-    {
-        if(MIDINoteMapping[i] > maxCallCount)
-        {
-            lastKeyPressed = i;
-            maxCallCount = MIDINoteMapping[i];
-        }
-    }
-
-    return lastKeyPressed;
+    return midiParser.GetMostRecentKey();
 }
 
 uint32_t GetMIDICallCount()
 {
-    return callCount;
+    return midiParser.GetCallCount();
 }
 
-// Check out a MIDI specification to understand the commands and the sequence of commands.
-// Just search for "MIDI specification" and you will find a lot of great online resources.
-void HandleMIDIMessage(uint8_t midiMessage)
+uint32_t GetMIDISysExMessage(uint8_t* message, uint32_t maxMessageSize)
 {
-    static bool noteOn = false;
-    static bool noteOff = false;
-    static uint8_t theNote = 0;
-    static uint8_t messagesAfterNoteCommand = 0;
-
-    // Ignore typical MIDI heartbeat/status messages
-    if(midiMessage == 0xFF || midiMessage == 0xFE)
-    {
-        return;
-    }
-
-    if(noteOn == true || noteOff == true)
-    {
-        messagesAfterNoteCommand++;
-        if(messagesAfterNoteCommand == 1)
-        {
-            theNote = midiMessage;
-        }
-        else if(messagesAfterNoteCommand == 2)
-        {
-            // A velocity of 0 means the note is off
-            if(noteOff == true || midiMessage == 0x00)
-            {
-                ++callCount;
-                MIDINoteMapping[theNote] = 0;
-            }
-            else if(noteOn == true)
-            {
-                ++callCount;
-                MIDINoteMapping[theNote] = callCount;
-            }
-
-            noteOn = false;
-            noteOff = false;
-            messagesAfterNoteCommand = 0;
-        }
-    }
-    else
-    {
-        if((midiMessage & 0xF0) == 0x90)
-        {
-            noteOn = true;
-            noteOff = false;
-            messagesAfterNoteCommand = 0;
-        }
-        else if((midiMessage & 0xF0) == 0x80)
-        {
-            noteOn = false;
-            noteOff = true;
-            messagesAfterNoteCommand = 0;
-        }
-    }
+    return midiParser.GetSysExMessage(message, maxMessageSize);
 }
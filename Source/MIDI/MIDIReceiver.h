@@ -29,3 +29,8 @@
 void InitializeMIDIReceiver();
 uint32_t GetMIDICallCount();
 int GetMostRecentMIDIKey();
+
+// Copies the last complete SysEx message (from the 0xF0 through to the 0xF7) into the given buffer
+// and returns its size.  Returns zero if no new message has arrived since the last call, or if it
+// doesn't fit.
+uint32_t GetMIDISysExMessage(uint8_t* message, uint32_t maxMessageSize);
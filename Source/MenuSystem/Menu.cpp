@@ -26,10 +26,16 @@
 
 #include "MenuSystem/Menu.h"
 
-Menu::Menu() : size_(0), parentMenu_(0) { }
+Menu::Menu(MenuItem* menuItems, uint8_t maxItems) :
+    size_(0), maxItems_((maxItems > MAX_ITEMS) ? MAX_ITEMS : maxItems), menuItems_(menuItems), parentMenu_(0) { }
 
 void Menu::AddItem(MenuItem menuItem)
 {
+if(size_ >= maxItems_)
+{
+    return;
+}
+
 menuItems_[size_] = menuItem;
 if(menuItems_[size_].GetSubMenu())
 {
@@ -45,7 +51,7 @@ return menuItems_[row];
 
 const char* Menu::GetMenuItemText(uint8_t row)
 {
-if(row >= MENU_ROWS)
+if(row >= size_)
 {
     return 0;            
 }
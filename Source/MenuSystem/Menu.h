@@ -32,9 +32,12 @@
 class Menu
 {
     public:
-        static const uint8_t MENU_ROWS = 4;
+        // Only four rows fit on the display at once, but the menu system scrolls so a menu can
+        // hold more items than that.  The items are kept in an array the menu's owner provides,
+        // sized to what the menu holds, so no menu pays SRAM for slots it never uses.
+        static const uint8_t MAX_ITEMS = 12;
 
-        Menu();
+        Menu(MenuItem* menuItems, uint8_t maxItems);
 
         void AddItem(MenuItem menuItem);
         MenuItem GetItem(uint8_t row);
@@ -45,6 +48,7 @@ class Menu
 
     private:
         uint8_t size_;
-        MenuItem menuItems_[MENU_ROWS];
+        uint8_t maxItems_;
+        MenuItem* menuItems_;
         Menu* parentMenu_;
 };
@@ -26,23 +26,13 @@
 
 #include "MenuSystem/MenuItem.h"
 #include "MenuSystem/MenuItemValue.h"
-#include "Utilities/StringUtilities.h"
 #include <stddef.h>
 
-MenuItem::MenuItem() : subMenu_(0), menuItemValue_(0)
-{
-    text_[0] = '\0';
-}
+MenuItem::MenuItem() : text_(""), subMenu_(0), menuItemValue_(0) { }
 
-MenuItem::MenuItem(const char* text, Menu* subMenu) : subMenu_(subMenu), menuItemValue_(0)
-{
-    StringCopy(text, text_, TEXT_SIZE);
-}
+MenuItem::MenuItem(const char* text, Menu* subMenu) : text_(text), subMenu_(subMenu), menuItemValue_(0) { }
 
-MenuItem::MenuItem(const char* text, MenuItemValue* menuItemValue) : menuItemValue_(menuItemValue), subMenu_(0)
-{
-    StringCopy(text, text_, TEXT_SIZE);
-}
+MenuItem::MenuItem(const char* text, MenuItemValue* menuItemValue) : text_(text), subMenu_(0), menuItemValue_(menuItemValue) { }
 
 const char* MenuItem::GetText()
 {
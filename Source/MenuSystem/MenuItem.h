@@ -48,7 +48,9 @@ class MenuItem
         MenuItemValue* GetMenuItemValue();
 
     private:
-        char text_[TEXT_SIZE + NULL_CHAR_SIZE];    
+        // Menu item text is always a string literal, so just point at it (in flash) rather than
+        // spend SRAM on a copy of it for every item of every menu.
+        const char* text_;
         Menu* subMenu_;
         MenuItemValue* menuItemValue_;
 };
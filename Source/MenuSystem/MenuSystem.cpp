@@ -34,6 +34,7 @@ MenuSystem::MenuSystem() :
     mainMenu_(0),
     currentMenu_(0),
     currentRow_(0),
+    topRow_(0),
     output_(0),
     valueTweaking_(false) { }
 
@@ -42,6 +43,7 @@ MenuSystem::MenuSystem(Menu* mainMenu, MenuOutput* output) :
     output_(output),
     currentMenu_(mainMenu_),
     currentRow_(0),
+    topRow_(0),
     valueTweaking_(false) { }
 
 // Resets screen to main menu
@@ -49,6 +51,7 @@ void MenuSystem::Reset()
 {
     currentMenu_ = mainMenu_;
     currentRow_ = 0;
+    topRow_ = 0;
     valueTweaking_ = false;
 
     UpdateText();
@@ -68,12 +71,34 @@ uint32_t MenuSystem::GetRowCount()
 {
     return currentMenu_->GetRowCount();    
 }
+
+Menu* MenuSystem::GetCurrentMenu()
+{
+    return currentMenu_;
+}
+
+uint8_t MenuSystem::GetCurrentRow()
+{
+    return currentRow_;
+}
+
+uint8_t MenuSystem::GetTopRow()
+{
+    return topRow_;
+}
+
+bool MenuSystem::GetValueTweaking()
+{
+    return valueTweaking_;
+}
     
 void MenuSystem::UpdateText()
 {
-    unsigned int currentRow = 0;
-    for( ; currentRow < currentMenu_->GetRowCount(); ++currentRow)
+    unsigned int line = 0;
+    for( ; line < MENU_ROWS && (topRow_ + line) < currentMenu_->GetRowCount(); ++line)
     {
+        uint8_t currentRow = topRow_ + line;
+
         char text[TEXT_SIZE + NULL_CHAR_SIZE];
         text[0] = '\0';
         if(currentRow_ == currentRow) StringCat("> ", text, TEXT_SIZE);
@@ -90,14 +115,28 @@ void MenuSystem::UpdateText()
             StringCat(menuItemValue->GetValueAsText(), text, TEXT_SIZE);
         }
 
-        output_->SetText(currentRow, text);
+        output_->SetText(line, text);
+    }
+
+    // Set any remaining lines to empty
+    while(line < MENU_ROWS)
+    {
+        output_->SetText(line, "");
+        ++line;
     }
+}
 
-    // Set any remaining rows to empty
-    while(currentRow < MENU_ROWS)
+// Menus can have more rows than fit on the display, so scroll just enough to keep the
+// current row visible.
+void MenuSystem::ScrollToCurrentRow()
+{
+    if(currentRow_ < topRow_)
+    {
+        topRow_ = currentRow_;
+    }
+    else if(currentRow_ >= topRow_ + MENU_ROWS)
     {
-        output_->SetText(currentRow, "");
-        ++currentRow;
+        topRow_ = currentRow_ - MENU_ROWS + 1;
     }
 }
 
@@ -114,6 +153,7 @@ void MenuSystem::HandleAction(MenuSystem::Action action)
         else if(currentRow_ + 1 < currentMenu_->GetRowCount())
         {
             ++currentRow_;    
+            ScrollToCurrentRow();
             UpdateText();
         }
     }
@@ -127,6 +167,7 @@ void MenuSystem::HandleAction(MenuSystem::Action action)
         else if(currentRow_ > 0)
         {
             --currentRow_;    
+            ScrollToCurrentRow();
             UpdateText();
         }
     }
@@ -136,6 +177,7 @@ void MenuSystem::HandleAction(MenuSystem::Action action)
         {
             currentMenu_ = currentMenu_->GetItem(currentRow_).GetSubMenu();
             currentRow_ = 0;
+            topRow_ = 0;
             UpdateText();
         }
         else if(valueTweaking_)
@@ -157,6 +199,7 @@ void MenuSystem::HandleAction(MenuSystem::Action action)
         {
             currentMenu_ = currentMenu_->GetParentMenu();
             currentRow_ = 0;
+            topRow_ = 0;
             UpdateText();
         }
     }
@@ -61,14 +61,22 @@ class MenuSystem
         void Reset();  // Resets screen to main menu
         void HandleAction(Action action);
         uint32_t GetRowCount();
+
+        // Where the menu's at, for tests to check
+        Menu* GetCurrentMenu();
+        uint8_t GetCurrentRow();
+        uint8_t GetTopRow();
+        bool GetValueTweaking();
     
     private:
         void Init();
         void UpdateText();
+        void ScrollToCurrentRow();
 
         Menu* mainMenu_;
         Menu* currentMenu_;
         uint8_t currentRow_;
+        uint8_t topRow_;  // The menu row shown on the first line of the display
         MenuOutput* output_;
         bool valueTweaking_;
 };
@@ -0,0 +1,50 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "MenuSystem/MenuItemValue.h"
+#include <stdint.h>
+
+class Chorus;
+
+class ChorusDepth : public MenuItemValue
+{
+    public:
+        ChorusDepth(Chorus& chorus);
+        void Increment();
+        void Decrement();
+        const char* GetValueAsText();
+        
+    private:
+        static const uint8_t MIN_VALUE_ = 0;
+        static const uint8_t MAX_VALUE_ = 100;
+        static const uint8_t ADJUSTMENT_VALUE_ = 5;
+        static const uint8_t TEXT_LENGTH_ = 5;
+
+        Chorus& chorus_;
+        char text_[TEXT_LENGTH_];
+};
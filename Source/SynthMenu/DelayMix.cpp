@@ -0,0 +1,54 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/DelayMix.h"
+#include "Utilities/StringUtilities.h"
+#include "AudioGeneration/Delay.h"
+
+DelayMix::DelayMix(Delay& delay) : delay_(delay) { }
+
+void DelayMix::Increment()
+{
+    if(delay_.GetMix() < MAX_VALUE_)
+    {
+        delay_.SetMix(delay_.GetMix() + ADJUSTMENT_VALUE_);
+    }
+}
+
+void DelayMix::Decrement()
+{
+    if(delay_.GetMix() > MIN_VALUE_)
+    {
+        delay_.SetMix(delay_.GetMix() - ADJUSTMENT_VALUE_);
+    }
+}
+
+const char* DelayMix::GetValueAsText()
+{
+    NumberToString(delay_.GetMix(), text_);
+    StringCat("%", text_, TEXT_LENGTH_);
+    return text_;
+}
@@ -0,0 +1,57 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/DelayTime.h"
+#include "Utilities/StringUtilities.h"
+#include "AudioGeneration/Delay.h"
+
+DelayTime::DelayTime(Delay& delay) : delay_(delay) { }
+
+void DelayTime::Increment()
+{
+    if(delay_.GetTime() < Delay::MAX_TIME)
+    {
+        delay_.SetTime(delay_.GetTime() + ADJUSTMENT_VALUE_);
+    }
+}
+
+void DelayTime::Decrement()
+{
+    if(delay_.GetTime() > MIN_VALUE_)
+    {
+        delay_.SetTime(delay_.GetTime() - ADJUSTMENT_VALUE_);
+    }
+}
+
+// The time is stored in 10 ms steps, so display it as e.g. "120ms"
+const char* DelayTime::GetValueAsText()
+{
+    if(delay_.GetTime() == 0) { return "Off"; }
+
+    NumberToString(delay_.GetTime() * 10, text_);
+    StringCat("ms", text_, TEXT_LENGTH_);
+    return text_;
+}
@@ -0,0 +1,59 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/FilterType.h"
+#include "AudioGeneration/StateVariableFilter.h"
+
+FilterType::FilterType(StateVariableFilter& filter) : filter_(filter) { }
+
+void FilterType::Increment()
+{
+    if(filter_.GetMode() == Bypass) { filter_.SetMode(HighPass); }
+    else if(filter_.GetMode() == LowPass) { filter_.SetMode(Bypass); }
+    else if(filter_.GetMode() == BandPass) { filter_.SetMode(LowPass); }
+    else if(filter_.GetMode() == HighPass) { filter_.SetMode(BandPass); }
+}
+
+void FilterType::Decrement()
+{
+    if(filter_.GetMode() == Bypass) { filter_.SetMode(LowPass); }
+    else if(filter_.GetMode() == LowPass) { filter_.SetMode(BandPass); }
+    else if(filter_.GetMode() == BandPass) { filter_.SetMode(HighPass); }
+    else if(filter_.GetMode() == HighPass) { filter_.SetMode(Bypass); }
+}
+
+const char* FilterType::GetValueAsText()
+{
+    if(filter_.GetMode() == LowPass) { return "Low Pass"; }
+    else if(filter_.GetMode() == BandPass) { return "Band Pass"; }
+    else if(filter_.GetMode() == HighPass) { return "High Pass"; }
+    return "Off";
+}
+
+FilterMode FilterType::GetMode()
+{
+    return filter_.GetMode();
+}
@@ -0,0 +1,54 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/GlideTime.h"
+#include "Utilities/StringUtilities.h"
+#include "AudioGeneration/Glide.h"
+
+GlideTime::GlideTime(Glide& glide) : glide_(glide) { }
+
+void GlideTime::Increment()
+{
+    if(glide_.GetTime() < MAX_VALUE_)
+    {
+        glide_.SetTime(glide_.GetTime() + ADJUSTMENT_VALUE_);
+    }
+}
+
+void GlideTime::Decrement()
+{
+    if(glide_.GetTime() > MIN_VALUE_)
+    {
+        glide_.SetTime(glide_.GetTime() - ADJUSTMENT_VALUE_);
+    }
+}
+
+const char* GlideTime::GetValueAsText()
+{
+    NumberToString(glide_.GetTime() * Glide::TIME_STEP_MS, text_);
+    StringCat("ms", text_, TEXT_LENGTH_);
+    return text_;
+}
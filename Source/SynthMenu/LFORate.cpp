@@ -0,0 +1,59 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/LFORate.h"
+#include "Utilities/StringUtilities.h"
+#include "AudioGeneration/LFO.h"
+
+LFORate::LFORate(LFO& lfo) : lfo_(lfo) { }
+
+void LFORate::Increment()
+{
+    if(lfo_.GetRate() < LFO::MAX_RATE)
+    {
+        lfo_.SetRate(lfo_.GetRate() + ADJUSTMENT_VALUE_);
+    }
+}
+
+void LFORate::Decrement()
+{
+    if(lfo_.GetRate() > LFO::MIN_RATE)
+    {
+        lfo_.SetRate(lfo_.GetRate() - ADJUSTMENT_VALUE_);
+    }
+}
+
+// The rate is stored in tenths of a Hz, so display it as e.g. "2.5Hz"
+const char* LFORate::GetValueAsText()
+{
+    char tenths[2] = { static_cast<char>('0' + lfo_.GetRate() % 10), '\0' };
+
+    NumberToString(lfo_.GetRate() / 10, text_);
+    StringCat(".", text_, TEXT_LENGTH_);
+    StringCat(tenths, text_, TEXT_LENGTH_);
+    StringCat("Hz", text_, TEXT_LENGTH_);
+    return text_;
+}
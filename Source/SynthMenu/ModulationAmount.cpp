@@ -0,0 +1,66 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/ModulationAmount.h"
+#include "SynthMenu/ModulationSlot.h"
+#include "Utilities/StringUtilities.h"
+#include "AudioGeneration/ModulationMatrix.h"
+
+ModulationAmount::ModulationAmount(ModulationMatrix& modulationMatrix, ModulationSlot& modulationSlot) :
+    modulationMatrix_(modulationMatrix), modulationSlot_(modulationSlot) { }
+
+void ModulationAmount::Increment()
+{
+    uint8_t slot = modulationSlot_.GetSlot();
+    if(modulationMatrix_.GetAmount(slot) < ModulationMatrix::MAX_AMOUNT)
+    {
+        modulationMatrix_.SetAmount(slot, modulationMatrix_.GetAmount(slot) + ADJUSTMENT_VALUE_);
+    }
+}
+
+void ModulationAmount::Decrement()
+{
+    uint8_t slot = modulationSlot_.GetSlot();
+    if(modulationMatrix_.GetAmount(slot) > ModulationMatrix::MIN_AMOUNT)
+    {
+        modulationMatrix_.SetAmount(slot, modulationMatrix_.GetAmount(slot) - ADJUSTMENT_VALUE_);
+    }
+}
+
+const char* ModulationAmount::GetValueAsText()
+{
+    int8_t amount = modulationMatrix_.GetAmount(modulationSlot_.GetSlot());
+    if(amount > 0)
+    {
+        text_[0] = '+';
+        NumberToString(amount, &(text_[1]));
+    }
+    else
+    {
+        NumberToString(amount, text_);
+    }
+    return text_;
+}
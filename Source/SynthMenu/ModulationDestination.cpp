@@ -0,0 +1,66 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/ModulationDestination.h"
+#include "SynthMenu/ModulationSlot.h"
+#include "AudioGeneration/ModulationMatrix.h"
+
+ModulationDestination::ModulationDestination(ModulationMatrix& modulationMatrix, ModulationSlot& modulationSlot) :
+    modulationMatrix_(modulationMatrix), modulationSlot_(modulationSlot) { }
+
+void ModulationDestination::Increment()
+{
+    uint8_t slot = modulationSlot_.GetSlot();
+    int destination = modulationMatrix_.GetDestination(slot) + 1;
+    if(destination == ModulationMatrix::DESTINATION_COUNT)
+    {
+        destination = ModulationMatrix::NO_DESTINATION;
+    }
+
+    modulationMatrix_.SetDestination(slot, static_cast<ModulationMatrix::Destination>(destination));
+}
+
+void ModulationDestination::Decrement()
+{
+    uint8_t slot = modulationSlot_.GetSlot();
+    int destination = modulationMatrix_.GetDestination(slot) - 1;
+    if(destination < ModulationMatrix::NO_DESTINATION)
+    {
+        destination = ModulationMatrix::DESTINATION_COUNT - 1;
+    }
+
+    modulationMatrix_.SetDestination(slot, static_cast<ModulationMatrix::Destination>(destination));
+}
+
+const char* ModulationDestination::GetValueAsText()
+{
+    ModulationMatrix::Destination destination = modulationMatrix_.GetDestination(modulationSlot_.GetSlot());
+    if(destination == ModulationMatrix::PITCH) { return "Pitch"; }
+    else if(destination == ModulationMatrix::LEVEL) { return "Level"; }
+    else if(destination == ModulationMatrix::FILTER_CUTOFF) { return "Cutoff"; }
+    else if(destination == ModulationMatrix::PULSE_WIDTH) { return "Pulse Width"; }
+    return "None";
+}
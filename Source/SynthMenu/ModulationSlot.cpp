@@ -0,0 +1,59 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/ModulationSlot.h"
+#include "Utilities/StringUtilities.h"
+#include "AudioGeneration/ModulationMatrix.h"
+
+ModulationSlot::ModulationSlot() : slot_(0) { }
+
+void ModulationSlot::Increment()
+{
+    if(slot_ + 1 < ModulationMatrix::SLOT_COUNT)
+    {
+        ++slot_;
+    }
+}
+
+void ModulationSlot::Decrement()
+{
+    if(slot_ > 0)
+    {
+        --slot_;
+    }
+}
+
+const char* ModulationSlot::GetValueAsText()
+{
+    // Slots are shown starting from one
+    NumberToString(slot_ + 1, text_);
+    return text_;
+}
+
+uint8_t ModulationSlot::GetSlot()
+{
+    return slot_;
+}
@@ -0,0 +1,64 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/ModulationSource.h"
+#include "SynthMenu/ModulationSlot.h"
+#include "AudioGeneration/ModulationMatrix.h"
+
+ModulationSource::ModulationSource(ModulationMatrix& modulationMatrix, ModulationSlot& modulationSlot) :
+    modulationMatrix_(modulationMatrix), modulationSlot_(modulationSlot) { }
+
+void ModulationSource::Increment()
+{
+    uint8_t slot = modulationSlot_.GetSlot();
+    int source = modulationMatrix_.GetSource(slot) + 1;
+    if(source == ModulationMatrix::SOURCE_COUNT)
+    {
+        source = ModulationMatrix::NO_SOURCE;
+    }
+
+    modulationMatrix_.SetSource(slot, static_cast<ModulationMatrix::Source>(source));
+}
+
+void ModulationSource::Decrement()
+{
+    uint8_t slot = modulationSlot_.GetSlot();
+    int source = modulationMatrix_.GetSource(slot) - 1;
+    if(source < ModulationMatrix::NO_SOURCE)
+    {
+        source = ModulationMatrix::SOURCE_COUNT - 1;
+    }
+
+    modulationMatrix_.SetSource(slot, static_cast<ModulationMatrix::Source>(source));
+}
+
+const char* ModulationSource::GetValueAsText()
+{
+    ModulationMatrix::Source source = modulationMatrix_.GetSource(modulationSlot_.GetSlot());
+    if(source == ModulationMatrix::LFO_1) { return "LFO 1"; }
+    else if(source == ModulationMatrix::LFO_2) { return "LFO 2"; }
+    return "None";
+}
@@ -32,17 +32,18 @@ OscillatorCent::OscillatorCent(Oscillator& oscillator) : oscillator_(oscillator)
 
 void OscillatorCent::Increment()
 {
-    if(oscillator_.GetCent() < MAX_VALUE_)
+    // The range is the oscillator's, so widening it there widens it here too
+    if(oscillator_.GetCent() < Oscillator::MAX_CENT)
     {
-        oscillator_.SetCent(oscillator_.GetCent() + 1);
+        oscillator_.SetCent(oscillator_.GetCent() + ADJUSTMENT_VALUE_);
     }
 }
 
 void OscillatorCent::Decrement()
 {
-    if(oscillator_.GetCent() > MIN_VALUE_)
+    if(oscillator_.GetCent() > Oscillator::MIN_CENT)
     {
-        oscillator_.SetCent(oscillator_.GetCent() - 1);
+        oscillator_.SetCent(oscillator_.GetCent() - ADJUSTMENT_VALUE_);
     }
 }
 
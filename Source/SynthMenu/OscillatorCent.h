@@ -40,11 +40,9 @@ class OscillatorCent : public MenuItemValue
         const char* GetValueAsText();
         
     private:
-        static const int8_t MIN_VALUE_ = -100;
-        static const int8_t MAX_VALUE_ = 100;
-        static const int8_t DEFAULT_VALUE_ = 0;
-        static const int8_t ADJUSTMENT_VALUE_ = 1;
-        static const uint8_t TEXT_LENGTH_ = 5;
+        static const int16_t DEFAULT_VALUE_ = 0;
+        static const int16_t ADJUSTMENT_VALUE_ = 1;
+        static const uint8_t TEXT_LENGTH_ = 7;
 
         Oscillator& oscillator_;
         char text_[TEXT_LENGTH_];
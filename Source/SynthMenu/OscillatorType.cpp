@@ -31,22 +31,31 @@ OscillatorType::OscillatorType(Oscillator& oscillator) : oscillator_(oscillator)
 
 void OscillatorType::Increment()
 {
-    if(oscillator_.GetWaveformType() == None) { oscillator_.SetWaveformType(Sawtooth); }
+    if(oscillator_.GetWaveformType() == None) { oscillator_.SetWaveformType(Sample); }
     else if(oscillator_.GetWaveformType() == Square) { oscillator_.SetWaveformType(None); }
     else if(oscillator_.GetWaveformType() == Sawtooth) { oscillator_.SetWaveformType(Square); }
+    else if(oscillator_.GetWaveformType() == Noise) { oscillator_.SetWaveformType(Sawtooth); }
+    else if(oscillator_.GetWaveformType() == PinkNoise) { oscillator_.SetWaveformType(Noise); }
+    else if(oscillator_.GetWaveformType() == Sample) { oscillator_.SetWaveformType(PinkNoise); }
 }
 
 void OscillatorType::Decrement()
 {
     if(oscillator_.GetWaveformType() == None) { oscillator_.SetWaveformType(Square); }
     else if(oscillator_.GetWaveformType() == Square) { oscillator_.SetWaveformType(Sawtooth); }
-    else if(oscillator_.GetWaveformType() == Sawtooth) { oscillator_.SetWaveformType(None); }
+    else if(oscillator_.GetWaveformType() == Sawtooth) { oscillator_.SetWaveformType(Noise); }
+    else if(oscillator_.GetWaveformType() == Noise) { oscillator_.SetWaveformType(PinkNoise); }
+    else if(oscillator_.GetWaveformType() == PinkNoise) { oscillator_.SetWaveformType(Sample); }
+    else if(oscillator_.GetWaveformType() == Sample) { oscillator_.SetWaveformType(None); }
 }
 
 const char* OscillatorType::GetValueAsText()
 {
     if(oscillator_.GetWaveformType() == None) { return "None"; }
     else if(oscillator_.GetWaveformType() == Square) { return "Square"; }
+    else if(oscillator_.GetWaveformType() == Noise) { return "Noise"; }
+    else if(oscillator_.GetWaveformType() == PinkNoise) { return "Pink"; }
+    else if(oscillator_.GetWaveformType() == Sample) { return "Sample"; }
     return "Sawtooth";
 }
 
@@ -0,0 +1,57 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/ReverbMix.h"
+#include "Utilities/StringUtilities.h"
+#include "AudioGeneration/Reverb.h"
+
+ReverbMix::ReverbMix(Reverb& reverb) : reverb_(reverb) { }
+
+void ReverbMix::Increment()
+{
+    if(reverb_.GetMix() < MAX_VALUE_)
+    {
+        reverb_.SetMix(reverb_.GetMix() + ADJUSTMENT_VALUE_);
+    }
+}
+
+void ReverbMix::Decrement()
+{
+    if(reverb_.GetMix() > MIN_VALUE_)
+    {
+        reverb_.SetMix(reverb_.GetMix() - ADJUSTMENT_VALUE_);
+    }
+}
+
+// Zero turns the reverb off
+const char* ReverbMix::GetValueAsText()
+{
+    if(reverb_.GetMix() == 0) { return "Off"; }
+
+    NumberToString(reverb_.GetMix(), text_);
+    StringCat("%", text_, TEXT_LENGTH_);
+    return text_;
+}
@@ -26,31 +26,128 @@
 
 #include "SynthMenu/SynthMenu.h"
 
-//SynthMenu::SynthMenu(MenuOutput* menuOutput, Oscillator& oscillators[3]) :
-SynthMenu::SynthMenu(MenuOutput* menuOutput, Oscillator& oscillator1, Oscillator& oscillator2, Oscillator& oscillator3) :
+SynthMenu::SynthMenu(MenuOutput* menuOutput, AudioMixer& audioMixer) :
     menuSystem_(&mainMenu_, menuOutput),
-    oscillator1Type_(oscillator1), oscillator1Level_(oscillator1), oscillator1Cent_(oscillator1), oscillator1Semitone_(oscillator1),
-    oscillator2Type_(oscillator2), oscillator2Level_(oscillator2), oscillator2Cent_(oscillator2), oscillator2Semitone_(oscillator2),
-    oscillator3Type_(oscillator3), oscillator3Level_(oscillator3), oscillator3Cent_(oscillator3), oscillator3Semitone_(oscillator3)
+    mainMenu_(mainMenuItems_, MAIN_MENU_ITEMS_),
+    oscillator1Menu_(oscillator1MenuItems_, OSCILLATOR_MENU_ITEMS_),
+    oscillator2Menu_(oscillator2MenuItems_, OSCILLATOR_MENU_ITEMS_),
+    oscillator3Menu_(oscillator3MenuItems_, OSCILLATOR_MENU_ITEMS_),
+    oscillatorLinkMenu_(oscillatorLinkMenuItems_, OSCILLATOR_LINK_MENU_ITEMS_),
+    filterMenu_(filterMenuItems_, FILTER_MENU_ITEMS_),
+    lfo1Menu_(lfo1MenuItems_, LFO_MENU_ITEMS_),
+    lfo2Menu_(lfo2MenuItems_, LFO_MENU_ITEMS_),
+    modulationMenu_(modulationMenuItems_, MODULATION_MENU_ITEMS_),
+    glideMenu_(glideMenuItems_, GLIDE_MENU_ITEMS_),
+    effectsMenu_(effectsMenuItems_, EFFECTS_MENU_ITEMS_),
+    outputMenu_(outputMenuItems_, OUTPUT_MENU_ITEMS_),
+    tuningMenu_(tuningMenuItems_, TUNING_MENU_ITEMS_),
+    oscillator1Type_(audioMixer.GetOscillator1()), oscillator2Type_(audioMixer.GetOscillator2()), oscillator3Type_(audioMixer.GetOscillator3()),
+    oscillator1Level_(audioMixer.GetOscillator1()), oscillator2Level_(audioMixer.GetOscillator2()), oscillator3Level_(audioMixer.GetOscillator3()),
+    oscillator1Cent_(audioMixer.GetOscillator1()), oscillator2Cent_(audioMixer.GetOscillator2()), oscillator3Cent_(audioMixer.GetOscillator3()),
+    oscillator1Semitone_(audioMixer.GetOscillator1()), oscillator2Semitone_(audioMixer.GetOscillator2()),
+    oscillator3Semitone_(audioMixer.GetOscillator3()),
+    oscillator1PulseWidth_(audioMixer.GetOscillator1()), oscillator2PulseWidth_(audioMixer.GetOscillator2()),
+    oscillator3PulseWidth_(audioMixer.GetOscillator3()),
+    oscillator1BandLimit_(audioMixer.GetOscillator1()), oscillator2BandLimit_(audioMixer.GetOscillator2()),
+    oscillator3BandLimit_(audioMixer.GetOscillator3()),
+    oscillator1Unison_(audioMixer.GetOscillator1()), oscillator2Unison_(audioMixer.GetOscillator2()),
+    oscillator3Unison_(audioMixer.GetOscillator3()),
+    oscillator1UnisonSpread_(audioMixer.GetOscillator1()), oscillator2UnisonSpread_(audioMixer.GetOscillator2()),
+    oscillator3UnisonSpread_(audioMixer.GetOscillator3()),
+    oscillatorHardSync_(audioMixer), oscillatorFMAmount_(audioMixer), oscillatorOversampling_(audioMixer),
+    filterType_(audioMixer.GetFilter()), filterCutoff_(audioMixer.GetFilter()), filterResonance_(audioMixer.GetFilter()),
+    lfo1Shape_(audioMixer.GetLFO1()), lfo2Shape_(audioMixer.GetLFO2()),
+    lfo1Rate_(audioMixer.GetLFO1()), lfo2Rate_(audioMixer.GetLFO2()),
+    modulationSource_(audioMixer.GetModulationMatrix(), modulationSlot_),
+    modulationDestination_(audioMixer.GetModulationMatrix(), modulationSlot_),
+    modulationAmount_(audioMixer.GetModulationMatrix(), modulationSlot_),
+    glideTime_(audioMixer.GetGlide()), glideMode_(audioMixer.GetGlide()), glideLegato_(audioMixer.GetGlide()),
+    chorusMode_(audioMixer.GetChorus()), chorusRate_(audioMixer.GetChorus()), chorusDepth_(audioMixer.GetChorus()),
+    delayTime_(audioMixer.GetDelay()), delayFeedback_(audioMixer.GetDelay()), delayMix_(audioMixer.GetDelay()),
+    reverbMix_(audioMixer.GetReverb()), reverbSize_(audioMixer.GetReverb()),
+    outputEnabled_(audioMixer.GetOutputStage()), outputGain_(audioMixer.GetOutputStage()), outputLimiter_(audioMixer.GetOutputStage()),
+    outputDither_(audioMixer.GetOutputStage()),
+    tuningScale_(audioMixer.GetTuning()), tuningReference_(audioMixer.GetTuning())
 {
     oscillator1Menu_.AddItem(MenuItem("Waveform", &oscillator1Type_));
     oscillator1Menu_.AddItem(MenuItem("Level", &oscillator1Level_));
     oscillator1Menu_.AddItem(MenuItem("Cent", &oscillator1Cent_));
     oscillator1Menu_.AddItem(MenuItem("Semitone", &oscillator1Semitone_));
+    oscillator1Menu_.AddItem(MenuItem("Pulse Width", &oscillator1PulseWidth_));
+    oscillator1Menu_.AddItem(MenuItem("Anti-Alias", &oscillator1BandLimit_));
+    oscillator1Menu_.AddItem(MenuItem("Unison", &oscillator1Unison_));
+    oscillator1Menu_.AddItem(MenuItem("Spread", &oscillator1UnisonSpread_));
 
     oscillator2Menu_.AddItem(MenuItem("Waveform", &oscillator2Type_));
     oscillator2Menu_.AddItem(MenuItem("Level", &oscillator2Level_));
     oscillator2Menu_.AddItem(MenuItem("Cent", &oscillator2Cent_));
     oscillator2Menu_.AddItem(MenuItem("Semitone", &oscillator2Semitone_));
+    oscillator2Menu_.AddItem(MenuItem("Pulse Width", &oscillator2PulseWidth_));
+    oscillator2Menu_.AddItem(MenuItem("Anti-Alias", &oscillator2BandLimit_));
+    oscillator2Menu_.AddItem(MenuItem("Unison", &oscillator2Unison_));
+    oscillator2Menu_.AddItem(MenuItem("Spread", &oscillator2UnisonSpread_));
 
     oscillator3Menu_.AddItem(MenuItem("Waveform", &oscillator3Type_));
     oscillator3Menu_.AddItem(MenuItem("Level", &oscillator3Level_));
     oscillator3Menu_.AddItem(MenuItem("Cent", &oscillator3Cent_));
     oscillator3Menu_.AddItem(MenuItem("Semitone", &oscillator3Semitone_));
+    oscillator3Menu_.AddItem(MenuItem("Pulse Width", &oscillator3PulseWidth_));
+    oscillator3Menu_.AddItem(MenuItem("Anti-Alias", &oscillator3BandLimit_));
+    oscillator3Menu_.AddItem(MenuItem("Unison", &oscillator3Unison_));
+    oscillator3Menu_.AddItem(MenuItem("Spread", &oscillator3UnisonSpread_));
+
+    oscillatorLinkMenu_.AddItem(MenuItem("Hard Sync", &oscillatorHardSync_));
+    oscillatorLinkMenu_.AddItem(MenuItem("FM Amount", &oscillatorFMAmount_));
+    oscillatorLinkMenu_.AddItem(MenuItem("Oversample", &oscillatorOversampling_));
+
+    filterMenu_.AddItem(MenuItem("Type", &filterType_));
+    filterMenu_.AddItem(MenuItem("Cutoff", &filterCutoff_));
+    filterMenu_.AddItem(MenuItem("Resonance", &filterResonance_));
+
+    lfo1Menu_.AddItem(MenuItem("Shape", &lfo1Shape_));
+    lfo1Menu_.AddItem(MenuItem("Rate", &lfo1Rate_));
+
+    lfo2Menu_.AddItem(MenuItem("Shape", &lfo2Shape_));
+    lfo2Menu_.AddItem(MenuItem("Rate", &lfo2Rate_));
+
+    modulationMenu_.AddItem(MenuItem("Slot", &modulationSlot_));
+    modulationMenu_.AddItem(MenuItem("Source", &modulationSource_));
+    modulationMenu_.AddItem(MenuItem("Dest", &modulationDestination_));
+    modulationMenu_.AddItem(MenuItem("Amount", &modulationAmount_));
+
+    glideMenu_.AddItem(MenuItem("Time", &glideTime_));
+    glideMenu_.AddItem(MenuItem("Mode", &glideMode_));
+    glideMenu_.AddItem(MenuItem("Legato", &glideLegato_));
+
+    effectsMenu_.AddItem(MenuItem("Chorus", &chorusMode_));
+    effectsMenu_.AddItem(MenuItem("Rate", &chorusRate_));
+    effectsMenu_.AddItem(MenuItem("Depth", &chorusDepth_));
+    effectsMenu_.AddItem(MenuItem("Delay", &delayTime_));
+    effectsMenu_.AddItem(MenuItem("Feedback", &delayFeedback_));
+    effectsMenu_.AddItem(MenuItem("Delay Mix", &delayMix_));
+    effectsMenu_.AddItem(MenuItem("Reverb", &reverbMix_));
+    effectsMenu_.AddItem(MenuItem("Room Size", &reverbSize_));
+
+    outputMenu_.AddItem(MenuItem("Enabled", &outputEnabled_));
+    outputMenu_.AddItem(MenuItem("Gain", &outputGain_));
+    outputMenu_.AddItem(MenuItem("Limiter", &outputLimiter_));
+    outputMenu_.AddItem(MenuItem("Dither", &outputDither_));
+
+    tuningMenu_.AddItem(MenuItem("Scale", &tuningScale_));
+    tuningMenu_.AddItem(MenuItem("Reference", &tuningReference_));
 
     mainMenu_.AddItem(MenuItem("Oscillator 1", &oscillator1Menu_));
     mainMenu_.AddItem(MenuItem("Oscillator 2", &oscillator2Menu_));
     mainMenu_.AddItem(MenuItem("Oscillator 3", &oscillator3Menu_));
+    mainMenu_.AddItem(MenuItem("Filter", &filterMenu_));
+    mainMenu_.AddItem(MenuItem("LFO 1", &lfo1Menu_));
+    mainMenu_.AddItem(MenuItem("LFO 2", &lfo2Menu_));
+    mainMenu_.AddItem(MenuItem("Mod Matrix", &modulationMenu_));
+    mainMenu_.AddItem(MenuItem("Sync / FM", &oscillatorLinkMenu_));
+    mainMenu_.AddItem(MenuItem("Glide", &glideMenu_));
+    mainMenu_.AddItem(MenuItem("Effects", &effectsMenu_));
+    mainMenu_.AddItem(MenuItem("Output", &outputMenu_));
+    mainMenu_.AddItem(MenuItem("Tuning", &tuningMenu_));
 
     menuSystem_.Reset();
 }
@@ -60,3 +157,7 @@ void SynthMenu::HandleAction(MenuSystem::Action  action)
     menuSystem_.HandleAction(action);
 }
 
+MenuSystem& SynthMenu::GetMenuSystem()
+{
+    return menuSystem_;
+}
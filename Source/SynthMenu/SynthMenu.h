@@ -34,22 +34,89 @@
 #include "SynthMenu/OscillatorSemitone.h"
 #include "SynthMenu/OscillatorLevel.h"
 #include "SynthMenu/OscillatorType.h"
-#include "AudioGeneration/Oscillator.h"
+#include "SynthMenu/OscillatorPulseWidth.h"
+#include "SynthMenu/OscillatorBandLimit.h"
+#include "SynthMenu/OscillatorUnison.h"
+#include "SynthMenu/OscillatorUnisonSpread.h"
+#include "SynthMenu/OscillatorHardSync.h"
+#include "SynthMenu/OscillatorFMAmount.h"
+#include "SynthMenu/OscillatorOversampling.h"
+#include "SynthMenu/FilterType.h"
+#include "SynthMenu/FilterCutoff.h"
+#include "SynthMenu/FilterResonance.h"
+#include "SynthMenu/LFOShape.h"
+#include "SynthMenu/LFORate.h"
+#include "SynthMenu/ModulationSlot.h"
+#include "SynthMenu/ModulationSource.h"
+#include "SynthMenu/ModulationDestination.h"
+#include "SynthMenu/ModulationAmount.h"
+#include "SynthMenu/GlideTime.h"
+#include "SynthMenu/GlideMode.h"
+#include "SynthMenu/GlideLegato.h"
+#include "SynthMenu/ChorusMode.h"
+#include "SynthMenu/ChorusRate.h"
+#include "SynthMenu/ChorusDepth.h"
+#include "SynthMenu/DelayTime.h"
+#include "SynthMenu/DelayFeedback.h"
+#include "SynthMenu/DelayMix.h"
+#include "SynthMenu/ReverbMix.h"
+#include "SynthMenu/ReverbSize.h"
+#include "SynthMenu/OutputEnabled.h"
+#include "SynthMenu/OutputGain.h"
+#include "SynthMenu/OutputLimiter.h"
+#include "SynthMenu/OutputDither.h"
+#include "SynthMenu/TuningScale.h"
+#include "SynthMenu/TuningReference.h"
+#include "AudioGeneration/AudioMixer.h"
 
 class SynthMenu
 {
     public:
-        //SynthMenu(MenuOutput* menuOutput, Oscillator& oscillators[3]);
-        SynthMenu(MenuOutput* menuOutput, Oscillator& oscillator1, Oscillator& oscillator2, Oscillator& oscillator3);
+        SynthMenu(MenuOutput* menuOutput, AudioMixer& audioMixer);
         void HandleAction(MenuSystem::Action action);
+        MenuSystem& GetMenuSystem();
 
     private:
+        // Each menu's items, sized to exactly what it holds (see Menu)
+        static const uint8_t MAIN_MENU_ITEMS_ = 12;
+        static const uint8_t OSCILLATOR_MENU_ITEMS_ = 8;
+        static const uint8_t OSCILLATOR_LINK_MENU_ITEMS_ = 3;
+        static const uint8_t FILTER_MENU_ITEMS_ = 3;
+        static const uint8_t LFO_MENU_ITEMS_ = 2;
+        static const uint8_t MODULATION_MENU_ITEMS_ = 4;
+        static const uint8_t GLIDE_MENU_ITEMS_ = 3;
+        static const uint8_t EFFECTS_MENU_ITEMS_ = 8;
+        static const uint8_t OUTPUT_MENU_ITEMS_ = 4;
+        static const uint8_t TUNING_MENU_ITEMS_ = 2;
+
+        MenuItem mainMenuItems_[MAIN_MENU_ITEMS_];
+        MenuItem oscillator1MenuItems_[OSCILLATOR_MENU_ITEMS_];
+        MenuItem oscillator2MenuItems_[OSCILLATOR_MENU_ITEMS_];
+        MenuItem oscillator3MenuItems_[OSCILLATOR_MENU_ITEMS_];
+        MenuItem oscillatorLinkMenuItems_[OSCILLATOR_LINK_MENU_ITEMS_];
+        MenuItem filterMenuItems_[FILTER_MENU_ITEMS_];
+        MenuItem lfo1MenuItems_[LFO_MENU_ITEMS_];
+        MenuItem lfo2MenuItems_[LFO_MENU_ITEMS_];
+        MenuItem modulationMenuItems_[MODULATION_MENU_ITEMS_];
+        MenuItem glideMenuItems_[GLIDE_MENU_ITEMS_];
+        MenuItem effectsMenuItems_[EFFECTS_MENU_ITEMS_];
+        MenuItem outputMenuItems_[OUTPUT_MENU_ITEMS_];
+        MenuItem tuningMenuItems_[TUNING_MENU_ITEMS_];
+
         MenuSystem menuSystem_;
         Menu mainMenu_;
-        Menu oscillatorMenu_;
         Menu oscillator1Menu_;
         Menu oscillator2Menu_;
         Menu oscillator3Menu_;
+        Menu oscillatorLinkMenu_;
+        Menu filterMenu_;
+        Menu lfo1Menu_;
+        Menu lfo2Menu_;
+        Menu modulationMenu_;
+        Menu glideMenu_;
+        Menu effectsMenu_;
+        Menu outputMenu_;
+        Menu tuningMenu_;
 
         OscillatorType oscillator1Type_;
         OscillatorType oscillator2Type_;
@@ -66,4 +133,60 @@ class SynthMenu
         OscillatorSemitone oscillator1Semitone_;
         OscillatorSemitone oscillator2Semitone_;
         OscillatorSemitone oscillator3Semitone_;
+
+        OscillatorPulseWidth oscillator1PulseWidth_;
+        OscillatorPulseWidth oscillator2PulseWidth_;
+        OscillatorPulseWidth oscillator3PulseWidth_;
+
+        OscillatorBandLimit oscillator1BandLimit_;
+        OscillatorBandLimit oscillator2BandLimit_;
+        OscillatorBandLimit oscillator3BandLimit_;
+
+        OscillatorUnison oscillator1Unison_;
+        OscillatorUnison oscillator2Unison_;
+        OscillatorUnison oscillator3Unison_;
+
+        OscillatorUnisonSpread oscillator1UnisonSpread_;
+        OscillatorUnisonSpread oscillator2UnisonSpread_;
+        OscillatorUnisonSpread oscillator3UnisonSpread_;
+
+        OscillatorHardSync oscillatorHardSync_;
+        OscillatorFMAmount oscillatorFMAmount_;
+        OscillatorOversampling oscillatorOversampling_;
+
+        FilterType filterType_;
+        FilterCutoff filterCutoff_;
+        FilterResonance filterResonance_;
+
+        LFOShape lfo1Shape_;
+        LFOShape lfo2Shape_;
+
+        LFORate lfo1Rate_;
+        LFORate lfo2Rate_;
+
+        ModulationSlot modulationSlot_;
+        ModulationSource modulationSource_;
+        ModulationDestination modulationDestination_;
+        ModulationAmount modulationAmount_;
+
+        GlideTime glideTime_;
+        GlideMode glideMode_;
+        GlideLegato glideLegato_;
+
+        ChorusMode chorusMode_;
+        ChorusRate chorusRate_;
+        ChorusDepth chorusDepth_;
+        DelayTime delayTime_;
+        DelayFeedback delayFeedback_;
+        DelayMix delayMix_;
+        ReverbMix reverbMix_;
+        ReverbSize reverbSize_;
+
+        OutputEnabled outputEnabled_;
+        OutputGain outputGain_;
+        OutputLimiter outputLimiter_;
+        OutputDither outputDither_;
+
+        TuningScale tuningScale_;
+        TuningReference tuningReference_;
 };
@@ -0,0 +1,52 @@
+/*
+ * ARM Cortex-M4F Synthesizer
+ *
+ * Copyright (c) 2017 Terence M. Darwen - tmdarwen.com
+ *
+ * The MIT License
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "SynthMenu/TuningScale.h"
+#include "AudioGeneration/Tuning.h"
+
+TuningScale::TuningScale(Tuning& tuning) : tuning_(tuning) { }
+
+void TuningScale::Increment()
+{
+    if(tuning_.GetScale() == Tuning::EQUAL) { tuning_.SetScale(Tuning::JUST); }
+    else if(tuning_.GetScale() == Tuning::JUST) { tuning_.SetScale(Tuning::PYTHAGOREAN); }
+    else if(tuning_.GetScale() == Tuning::PYTHAGOREAN) { tuning_.SetScale(Tuning::MEANTONE); }
+}
+
+void TuningScale::Decrement()
+{
+    if(tuning_.GetScale() == Tuning::MEANTONE) { tuning_.SetScale(Tuning::PYTHAGOREAN); }
+    else if(tuning_.GetScale() == Tuning::PYTHAGOREAN) { tuning_.SetScale(Tuning::JUST); }
+    else if(tuning_.GetScale() == Tuning::JUST) { tuning_.SetScale(Tuning::EQUAL); }
+}
+
+const char* TuningScale::GetValueAsText()
+{
+    if(tuning_.GetScale() == Tuning::JUST) { return "Just"; }
+    else if(tuning_.GetScale() == Tuning::PYTHAGOREAN) { return "Pythagorean"; }
+    else if(tuning_.GetScale() == Tuning::MEANTONE) { return "Meantone"; }
+    return "Equal";
+}
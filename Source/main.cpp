@@ -35,13 +35,27 @@
 #include "TM4C123G/TimedInterrupt.h"
 #include "Utilities/Logger.h"
 #include "Utilities/HelperFunctions.h"
+#include "Utilities/StringUtilities.h"
 #include <stdint.h>
 #include "inc/tm4c123gh6pm.h"
 
 uint64_t timerCounter = 0;
 
+// Timer0A fires every 1000 clock cycles, so this is about two seconds at 80 MHz
+const uint32_t loadReportTimerCount = 160000;
+
 AudioMixer* pAudioMixer;
 
+// Long enough for a tuning change of up to 28 notes
+const uint32_t maxSysExMessageSize = 128;
+
+// The linker's --stack_size (see ProjectFiles/.cproject).  main's locals stay on the stack for good
+// and every interrupt handler's frame goes on top of them, so anything sizeable is static instead.
+// The locals that are left (the menu input in main and the SysEx buffer in the audio callback)
+// mustn't take more than an eighth of it.
+const uint32_t stackSize = 4096;
+typedef char StackLocalsMustBeSmall[(sizeof(SynthMenuInput) + maxSysExMessageSize <= stackSize / 8) ? 1 : -1];
+
 // This function gets called when AudioOutput needs new audio samples
 void FillAudioBufferCallback(uint16_t* buffer, uint32_t bufferSampleSize)
 {
@@ -55,12 +69,40 @@ void FillAudioBufferCallback(uint16_t* buffer, uint32_t bufferSampleSize)
         pAudioMixer->SetMIDINote(GetMostRecentMIDIKey());
     }
 
+    // Tuning changes are applied here, between blocks, so the oscillators never see a note's tuning
+    // change part way through one
+    uint8_t sysExMessage[maxSysExMessageSize];
+    uint32_t sysExMessageSize = GetMIDISysExMessage(sysExMessage, maxSysExMessageSize);
+    if(sysExMessageSize != 0)
+    {
+        pAudioMixer->GetTuning().HandleSysEx(sysExMessage, sysExMessageSize);
+    }
+
     pAudioMixer->GetAudioData(buffer, bufferSampleSize);
 }
 
 LCDOutput* pLCDOutput = 0;
 SynthMenuInput* pSynthMenuInput = 0;
 
+// Logs how close audio generation has come to running out of time since the last report, which
+// shows whether a patch (with oversampling on, say) is affordable.
+void ReportAudioLoad()
+{
+    static uint64_t lastReportTimerCount = 0;
+    if(timerCounter - lastReportTimerCount < loadReportTimerCount)
+    {
+        return;
+    }
+
+    lastReportTimerCount = timerCounter;
+
+    char loadText[12];
+    NumberToString(GetAudioOutputPeakLoad(), loadText);
+    Logger::PrintString("Peak audio load: ");
+    Logger::PrintString(loadText);
+    Logger::PrintStringWithNewLine("%");
+}
+
 extern "C" void Timer0AHandler(void)
 {
     TIMER0_ICR_R = TIMER_ICR_TATOCINT;  // Clear the timer interrupt
@@ -85,15 +127,17 @@ void main()
     Logger::PrintString("Build Time: ");
     Logger::PrintStringWithNewLine(__TIME__);
 
+    // The mixer (with the effects' delay lines), the LCD's action queue and the menus are all far
+    // too big for the stack, so they're static.  Only the menu input, which is tiny, is left on it.
     Logger::PrintStringWithNewLine("Initializing Audio Mixer");
-    AudioMixer audioMixer;
+    static AudioMixer audioMixer;
     pAudioMixer = &audioMixer;
 
     Logger::PrintStringWithNewLine("Initializing LCD Menu");
-    LCDOutput lcdOutput;
+    static LCDOutput lcdOutput;
 
     Logger::PrintStringWithNewLine("Initializing Synth Menu");
-    SynthMenu synthMenu(&lcdOutput, audioMixer.GetOscillator1(), audioMixer.GetOscillator2(), audioMixer.GetOscillator3());
+    static SynthMenu synthMenu(&lcdOutput, audioMixer);
 
     Logger::PrintStringWithNewLine("Initializing Synth Menu Inputs");
     SynthMenuInput synthMenuInput(&synthMenu);
@@ -116,5 +160,6 @@ void main()
     while(1)
     {
        WaitForInterrupt();
+       ReportAudioLoad();
     }
 }
@@ -0,0 +1,171 @@
+#include <AudioGeneration-UT/ToneAnalysis.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <AudioGeneration/AudioMixer.h>
+#include <AudioGeneration/WaveformTypes.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Measures how clean the oscillators sound, where AudioGeneration-Bench measures what they cost.
+// Each waveform is rendered on its own at every octave across the MIDI range, plain, band limited,
+// oversampled and both, and its spectrum is broken down into the harmonics, aliasing and the noise
+// floor (see ToneAnalysis.h).
+
+// One octave apart from the bottom of the keyboard to the top
+const uint8_t noteIndexes[]{12, 24, 36, 48, 60, 72, 84, 96, 108, 120};
+
+struct Mode
+{
+    const char* name;
+    bool bandLimited;
+    bool oversampling;
+};
+
+const Mode modes[]
+{
+    {"plain", false, false},
+    {"band limited", true, false},
+    {"oversampled", false, true},
+    {"band limited + oversampled", true, true}
+};
+
+struct Result
+{
+    const char* waveform;
+    const Mode* mode;
+    uint8_t noteIndex;
+    ToneAnalysis analysis;
+};
+
+std::vector<Result> results;
+
+// With the JSON going to stdout, the table goes to stderr instead
+FILE* tableOutput{stdout};
+
+std::string Quote(const std::string& text)
+{
+    std::string quoted{"\""};
+    for(char character : text)
+    {
+        if(character == '"' || character == '\\')
+        {
+            quoted += '\\';
+        }
+        quoted += character;
+    }
+    return quoted + "\"";
+}
+
+void Analyze(WaveformType waveformType, const char* waveformName, const Mode& mode, uint8_t noteIndex)
+{
+    // Just the one oscillator, in tune, so every tone in the spectrum is its own
+    AudioMixer audioMixer;
+    audioMixer.GetOscillator1().SetWaveformType(waveformType);
+    audioMixer.GetOscillator1().SetBandLimited(mode.bandLimited);
+    audioMixer.GetOscillator2().SetWaveformType(None);
+    audioMixer.GetOscillator3().SetWaveformType(None);
+    audioMixer.SetOversampling(mode.oversampling);
+
+    ToneAnalysis analysis{AnalyzeNote(audioMixer, noteIndex)};
+    std::fprintf(tableOutput, "%-9s %-27s %4u %9.1f Hz %9.1f %9.1f %9.1f %9.1f\n", waveformName, mode.name,
+        static_cast<unsigned>(noteIndex), analysis.fundamentalFrequency, analysis.aliasing, analysis.thd,
+        analysis.thdPlusNoise, analysis.noiseFloor);
+    results.push_back(Result{waveformName, &mode, noteIndex, analysis});
+}
+
+void WriteJSON(FILE* file)
+{
+    std::fprintf(file, "{\n");
+    std::fprintf(file, "  \"analysis\": \"AudioGeneration-Analysis\",\n");
+    std::fprintf(file, "  \"sample_rate\": %.0f,\n", static_cast<double>(SAMPLE_RATE));
+    std::fprintf(file, "  \"results\": [\n");
+    for(std::size_t i{0}; i < results.size(); ++i)
+    {
+        const Result& result{results[i]};
+        std::fprintf(file, "    {\"waveform\": %s, \"band_limited\": %s, \"oversampling\": %s, \"note\": %u, "
+            "\"fundamental_hz\": %.3f, \"aliasing_db\": %.2f, \"thd_db\": %.2f, \"thd_plus_noise_db\": %.2f, "
+            "\"noise_floor_db\": %.2f}%s\n", Quote(result.waveform).c_str(), result.mode->bandLimited ? "true" : "false",
+            result.mode->oversampling ? "true" : "false", static_cast<unsigned>(result.noteIndex),
+            result.analysis.fundamentalFrequency, result.analysis.aliasing, result.analysis.thd,
+            result.analysis.thdPlusNoise, result.analysis.noiseFloor, (i + 1 < results.size()) ? "," : "");
+    }
+    std::fprintf(file, "  ]\n");
+    std::fprintf(file, "}\n");
+}
+
+void PrintUsage()
+{
+    std::printf("Usage: AudioGeneration-Analysis [--json <file>]\n");
+    std::printf("  --json <file>  Also write the results as JSON (\"-\" for stdout, which moves the table to stderr)\n");
+}
+
+int main(int argc, char* argv[])
+{
+    const char* jsonPath{nullptr};
+    for(int i{1}; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else
+        {
+            PrintUsage();
+            return (std::strcmp(argv[i], "--help") == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    bool jsonToStdout{jsonPath != nullptr && std::strcmp(jsonPath, "-") == 0};
+    if(jsonToStdout)
+    {
+        tableOutput = stderr;
+    }
+
+    std::fprintf(tableOutput, "All levels are in dB relative to the fundamental\n");
+    std::fprintf(tableOutput, "%-9s %-27s %4s %12s %9s %9s %9s %9s\n", "Waveform", "Mode", "Note", "Fundamental",
+        "Aliasing", "THD", "THD+N", "Floor");
+
+    try
+    {
+        for(const Mode& mode : modes)
+        {
+            for(uint8_t noteIndex : noteIndexes)
+            {
+                Analyze(Sawtooth, "Sawtooth", mode, noteIndex);
+            }
+        }
+
+        for(const Mode& mode : modes)
+        {
+            for(uint8_t noteIndex : noteIndexes)
+            {
+                Analyze(Square, "Square", mode, noteIndex);
+            }
+        }
+    }
+    catch(const Exception& exception)
+    {
+        std::fprintf(stderr, "AudioGeneration-Analysis: %s\n", exception.what());
+        return EXIT_FAILURE;
+    }
+
+    if(jsonPath != nullptr)
+    {
+        FILE* jsonFile{jsonToStdout ? stdout : std::fopen(jsonPath, "w")};
+        if(jsonFile == nullptr)
+        {
+            std::fprintf(stderr, "Couldn't open %s\n", jsonPath);
+            return EXIT_FAILURE;
+        }
+
+        WriteJSON(jsonFile);
+        if(!jsonToStdout)
+        {
+            std::fclose(jsonFile);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
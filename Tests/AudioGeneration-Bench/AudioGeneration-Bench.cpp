@@ -0,0 +1,514 @@
+#include <AudioGeneration/AudioMixer.h>
+#include <AudioGeneration/WaveformTypes.h>
+#include <AudioGeneration/Tuning.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_CYCLE_COUNTER
+#endif
+
+// The firmware fills the DAC's DMA buffers 256 samples at a time (see AudioOutput), so that's the
+// block size the benchmark renders with unless it's measuring the block size itself.
+const std::size_t samplesPerSecond{44100};
+const std::size_t firmwareBufferSampleSize{256};
+const std::size_t c3NoteIndex{48};
+
+// How much audio each case renders, and how many times.  --quick cuts these down for a smoke test.
+std::size_t secondsToRender{10};
+std::size_t runCount{5};
+
+struct Measurement
+{
+    double nanosecondsPerSample;
+    double cyclesPerBlock;  // Per control block, or zero where there's no cycle counter to read
+};
+
+// What a case was rendering, as JSON values (so strings are already quoted)
+typedef std::vector<std::pair<std::string, std::string>> Parameters;
+
+struct Result
+{
+    std::string suite;
+    std::string name;
+    Parameters parameters;
+    Measurement measurement;
+};
+
+std::vector<Result> results;
+
+uint64_t ReadCycleCounter()
+{
+#ifdef BENCH_HAS_CYCLE_COUNTER
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// Renders a fixed amount of audio a few times and returns the average cost of the fastest run (the
+// slower runs are mostly measuring whatever else the machine is doing).  The cost per control block
+// is the one to compare against the firmware's budget, and against the cost of each voice.
+Measurement Measure(AudioMixer& audioMixer, std::size_t bufferSampleSize = firmwareBufferSampleSize,
+                    uint8_t noteIndex = c3NoteIndex)
+{
+    std::vector<uint16_t> buffer(bufferSampleSize);
+    const std::size_t bufferCount{(samplesPerSecond * secondsToRender) / bufferSampleSize};
+    const double blockCount{static_cast<double>(bufferCount * bufferSampleSize) / CONTROL_BLOCK_SIZE};
+    Measurement fastestRun{0.0, 0.0};
+
+    audioMixer.SetMIDINote(noteIndex);
+
+    for(std::size_t run{0}; run < runCount; ++run)
+    {
+        auto startTime{std::chrono::steady_clock::now()};
+        uint64_t startCycles{ReadCycleCounter()};
+        for(std::size_t i{0}; i < bufferCount; ++i)
+        {
+            audioMixer.GetAudioData(buffer.data(), bufferSampleSize);
+        }
+        uint64_t endCycles{ReadCycleCounter()};
+        auto endTime{std::chrono::steady_clock::now()};
+
+        std::chrono::duration<double, std::nano> elapsed{endTime - startTime};
+        double nanosecondsPerSample{elapsed.count() / static_cast<double>(bufferCount * bufferSampleSize)};
+        if(run == 0 || nanosecondsPerSample < fastestRun.nanosecondsPerSample)
+        {
+            fastestRun.nanosecondsPerSample = nanosecondsPerSample;
+            fastestRun.cyclesPerBlock = static_cast<double>(endCycles - startCycles) / blockCount;
+        }
+    }
+
+    return fastestRun;
+}
+
+// One second of audio has to be rendered in under a second, so this is the fraction of one core's
+// time (on this machine) the render takes up.
+double GetRealTimeLoad(const Measurement& measurement)
+{
+    return measurement.nanosecondsPerSample * static_cast<double>(samplesPerSecond) / 1.0e9;
+}
+
+// Prints the result as it comes in and keeps it for the JSON report.  With the JSON going to
+// stdout, the table goes to stderr instead.
+FILE* tableOutput{stdout};
+
+void Report(const std::string& suite, const std::string& name, const Measurement& measurement,
+            const Parameters& parameters = Parameters{})
+{
+    std::fprintf(tableOutput, "%-32s %10.2f ns/sample %10.4f%% real-time load %10.0f cycles/block\n", name.c_str(),
+        measurement.nanosecondsPerSample, GetRealTimeLoad(measurement) * 100.0, measurement.cyclesPerBlock);
+    results.push_back(Result{suite, name, parameters, measurement});
+}
+
+std::string Quote(const std::string& text)
+{
+    std::string quoted{"\""};
+    for(char character : text)
+    {
+        if(character == '"' || character == '\\')
+        {
+            quoted += '\\';
+        }
+        quoted += character;
+    }
+    return quoted + "\"";
+}
+
+const char* GetWaveformName(WaveformType waveformType)
+{
+    switch(waveformType)
+    {
+        case Square: return "Square";
+        case Sawtooth: return "Sawtooth";
+        case Noise: return "Noise";
+        case PinkNoise: return "PinkNoise";
+        case Sample: return "Sample";
+        default: return "None";
+    }
+}
+
+// Writes everything measured as one JSON document, so runs from different releases (or machines)
+// can be compared by a script.  The build details are there because the numbers mean little
+// without them.
+void WriteJSON(FILE* file)
+{
+#ifdef NDEBUG
+    const char* buildType{"Release"};
+#else
+    const char* buildType{"Debug"};
+#endif
+
+    std::fprintf(file, "{\n");
+    std::fprintf(file, "  \"benchmark\": \"AudioGeneration-Bench\",\n");
+    std::fprintf(file, "  \"compiler\": %s,\n", Quote(__VERSION__).c_str());
+    std::fprintf(file, "  \"build_type\": \"%s\",\n", buildType);
+    std::fprintf(file, "  \"sample_rate\": %zu,\n", samplesPerSecond);
+    std::fprintf(file, "  \"control_block_size\": %u,\n", static_cast<unsigned>(CONTROL_BLOCK_SIZE));
+    std::fprintf(file, "  \"seconds_rendered\": %zu,\n", secondsToRender);
+    std::fprintf(file, "  \"runs\": %zu,\n", runCount);
+    std::fprintf(file, "  \"results\": [\n");
+    for(std::size_t i{0}; i < results.size(); ++i)
+    {
+        const Result& result{results[i]};
+        std::fprintf(file, "    {\"suite\": %s, \"name\": %s, \"parameters\": {", Quote(result.suite).c_str(),
+            Quote(result.name).c_str());
+        for(std::size_t parameter{0}; parameter < result.parameters.size(); ++parameter)
+        {
+            std::fprintf(file, "%s%s: %s", parameter ? ", " : "", Quote(result.parameters[parameter].first).c_str(),
+                result.parameters[parameter].second.c_str());
+        }
+        std::fprintf(file, "}, \"ns_per_sample\": %.4f, \"real_time_load\": %.8f, \"cycles_per_block\": %.1f}%s\n",
+            result.measurement.nanosecondsPerSample, GetRealTimeLoad(result.measurement),
+            result.measurement.cyclesPerBlock, (i + 1 < results.size()) ? "," : "");
+    }
+    std::fprintf(file, "  ]\n");
+    std::fprintf(file, "}\n");
+}
+
+// Renders voiceCount oscillators (alternating sawtooth and square, at different notes) one control
+// block at a time, either a sample at a time through RenderSample (as the mixer does when the
+// oscillators are linked) or through each oscillator's own block loop, and returns the cost per voice.
+const uint8_t maxVoiceCount{8};
+Measurement MeasureVoices(uint8_t voiceCount, bool perSample)
+{
+    Tuning tuning;
+    Oscillator oscillators[maxVoiceCount];
+    for(uint8_t voice{0}; voice < voiceCount; ++voice)
+    {
+        oscillators[voice].SetWaveformType(voice % 2 ? Square : Sawtooth);
+    }
+
+    uint16_t block[CONTROL_BLOCK_SIZE];
+    const std::size_t blockCount{(samplesPerSecond * secondsToRender) / CONTROL_BLOCK_SIZE};
+    Measurement fastestRun{0.0, 0.0};
+
+    for(std::size_t run{0}; run < runCount; ++run)
+    {
+        auto startTime{std::chrono::steady_clock::now()};
+        uint64_t startCycles{ReadCycleCounter()};
+        for(std::size_t i{0}; i < blockCount; ++i)
+        {
+            for(uint32_t sample{0}; sample < CONTROL_BLOCK_SIZE; ++sample)
+            {
+                block[sample] = 0;
+            }
+
+            for(uint8_t voice{0}; voice < voiceCount; ++voice)
+            {
+                oscillators[voice].StartBlock(voiceCount, c3NoteIndex + voice, tuning, 1.0f, 1.0f, 0.0f);
+                if(perSample)
+                {
+                    for(uint32_t sample{0}; sample < CONTROL_BLOCK_SIZE; ++sample)
+                    {
+                        block[sample] += static_cast<uint16_t>(oscillators[voice].RenderSample(1.0f));
+                    }
+                }
+                else
+                {
+                    oscillators[voice].MixInOscillatorAudio(block, CONTROL_BLOCK_SIZE);
+                }
+            }
+        }
+        uint64_t endCycles{ReadCycleCounter()};
+        auto endTime{std::chrono::steady_clock::now()};
+
+        std::chrono::duration<double, std::nano> elapsed{endTime - startTime};
+        double voiceSampleCount{static_cast<double>(blockCount * CONTROL_BLOCK_SIZE * voiceCount)};
+        double nanosecondsPerSample{elapsed.count() / voiceSampleCount};
+        if(run == 0 || nanosecondsPerSample < fastestRun.nanosecondsPerSample)
+        {
+            fastestRun.nanosecondsPerSample = nanosecondsPerSample;
+            fastestRun.cyclesPerBlock = static_cast<double>(endCycles - startCycles) / (blockCount * voiceCount);
+        }
+    }
+
+    return fastestRun;
+}
+
+void PrintUsage()
+{
+    std::printf("Usage: AudioGeneration-Bench [--json <file>] [--quick]\n");
+    std::printf("  --json <file>  Also write the results as JSON (\"-\" for stdout, which moves the table to stderr)\n");
+    std::printf("  --quick        Render 1 second, 2 times, per case rather than 10 seconds, 5 times\n");
+}
+
+// Renders the same patch (all three oscillators on one waveform) with each of the sweep's settings
+// changed on its own, so a regression can be pinned on a waveform, oscillator count, block size or
+// note range.
+void RunSweeps()
+{
+    const WaveformType waveformTypes[]{Square, Sawtooth, Noise, PinkNoise, Sample};
+    for(WaveformType waveformType : waveformTypes)
+    {
+        for(bool bandLimited : {false, true})
+        {
+            if(bandLimited && waveformType != Square && waveformType != Sawtooth)
+            {
+                continue;
+            }
+
+            AudioMixer audioMixer;
+            for(Oscillator* oscillator : {&audioMixer.GetOscillator1(), &audioMixer.GetOscillator2(), &audioMixer.GetOscillator3()})
+            {
+                oscillator->SetWaveformType(waveformType);
+                oscillator->SetBandLimited(bandLimited);
+            }
+
+            std::string name{std::string{"Waveform "} + GetWaveformName(waveformType) + (bandLimited ? " (band limited)" : "")};
+            Report("waveform", name, Measure(audioMixer), Parameters{{"waveform", Quote(GetWaveformName(waveformType))},
+                {"band_limited", bandLimited ? "true" : "false"}, {"oscillator_count", "3"}});
+        }
+    }
+
+    for(uint8_t oscillatorCount : {1, 2, 3})
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(oscillatorCount > 1 ? Sawtooth : None);
+        audioMixer.GetOscillator3().SetWaveformType(oscillatorCount > 2 ? Sawtooth : None);
+        Report("oscillator-count", "Sawtooth x" + std::to_string(oscillatorCount), Measure(audioMixer),
+            Parameters{{"waveform", "\"Sawtooth\""}, {"oscillator_count", std::to_string(oscillatorCount)}});
+    }
+
+    // Below a control block the per-block work (modulation, tuning, coefficients) is done more often
+    for(std::size_t blockSize : {16, 32, 64, 128, 256, 512, 1024})
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.GetFilter().SetMode(LowPass);
+        Report("block-size", "Block of " + std::to_string(blockSize), Measure(audioMixer, blockSize),
+            Parameters{{"waveform", "\"Sawtooth\""}, {"filter", "\"LowPass\""}, {"block_size", std::to_string(blockSize)}});
+    }
+
+    // High notes wrap their cycle far more often, and band limiting only corrects near the wraps
+    const std::pair<const char*, uint8_t> noteRanges[]{{"low", 12}, {"mid", 48}, {"high", 84}, {"top", 108}};
+    for(const std::pair<const char*, uint8_t>& noteRange : noteRanges)
+    {
+        for(bool bandLimited : {false, true})
+        {
+            AudioMixer audioMixer;
+            for(Oscillator* oscillator : {&audioMixer.GetOscillator1(), &audioMixer.GetOscillator2(), &audioMixer.GetOscillator3()})
+            {
+                oscillator->SetWaveformType(Sawtooth);
+                oscillator->SetBandLimited(bandLimited);
+            }
+
+            std::string name{std::string{"Note "} + std::to_string(noteRange.second) + " (" + noteRange.first +
+                (bandLimited ? ", band limited)" : ")")};
+            Report("note-range", name, Measure(audioMixer, firmwareBufferSampleSize, noteRange.second),
+                Parameters{{"waveform", "\"Sawtooth\""}, {"band_limited", bandLimited ? "true" : "false"},
+                {"range", Quote(noteRange.first)}, {"note", std::to_string(noteRange.second)}});
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    const char* jsonPath{nullptr};
+    for(int i{1}; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+        {
+            jsonPath = argv[++i];
+        }
+        else if(std::strcmp(argv[i], "--quick") == 0)
+        {
+            secondsToRender = 1;
+            runCount = 2;
+        }
+        else
+        {
+            PrintUsage();
+            return (std::strcmp(argv[i], "--help") == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    bool jsonToStdout{jsonPath != nullptr && std::strcmp(jsonPath, "-") == 0};
+    if(jsonToStdout)
+    {
+        tableOutput = stderr;
+    }
+
+    {
+        AudioMixer audioMixer;
+        Report("features", "Default (filter off)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetFilter().SetMode(LowPass);
+        audioMixer.GetFilter().SetCutoff(80);
+        audioMixer.GetFilter().SetResonance(5);
+        Report("features", "Default (low pass filter)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        Report("features", "Sawtooth (filter off)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.GetFilter().SetMode(LowPass);
+        audioMixer.GetFilter().SetCutoff(80);
+        audioMixer.GetFilter().SetResonance(5);
+        Report("features", "Sawtooth (low pass filter)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.GetFilter().SetMode(LowPass);
+        audioMixer.GetFilter().SetCutoff(80);
+        audioMixer.GetFilter().SetResonance(5);
+
+        // Fill every slot of the modulation matrix
+        ModulationMatrix& modulationMatrix{audioMixer.GetModulationMatrix()};
+        for(uint8_t slot{0}; slot < ModulationMatrix::SLOT_COUNT; ++slot)
+        {
+            modulationMatrix.SetSource(slot, (slot % 2) ? ModulationMatrix::LFO_1 : ModulationMatrix::LFO_2);
+            modulationMatrix.SetDestination(slot, (slot % 2) ? ModulationMatrix::PITCH : ModulationMatrix::FILTER_CUTOFF);
+            modulationMatrix.SetAmount(slot, 5);
+        }
+        Report("features", "Sawtooth (filter + 8 mod slots)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.SetHardSync(true);
+        Report("features", "Sawtooth (hard sync)", Measure(audioMixer));
+
+        audioMixer.SetOversampling(true);
+        Report("features", "Sawtooth (sync, 2x oversampled)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.SetFMAmount(50);
+        Report("features", "Sawtooth (FM)", Measure(audioMixer));
+
+        audioMixer.SetOversampling(true);
+        Report("features", "Sawtooth (FM, 2x oversampled)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Noise);
+        audioMixer.GetOscillator2().SetWaveformType(PinkNoise);
+        audioMixer.GetOscillator3().SetWaveformType(None);
+        Report("features", "White + pink noise", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sample);
+        audioMixer.GetOscillator2().SetWaveformType(Sample);
+        audioMixer.GetOscillator3().SetWaveformType(Sample);
+        audioMixer.GetOscillator2().SetSemitone(7);
+        Report("features", "Sample", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.GetFilter().SetMode(LowPass);
+        audioMixer.GetFilter().SetCutoff(80);
+        audioMixer.GetFilter().SetResonance(5);
+        audioMixer.GetOutputStage().SetEnabled(true);
+        audioMixer.GetOutputStage().SetGain(6);
+        Report("features", "Sawtooth (filter + output stage)", Measure(audioMixer));
+
+        audioMixer.GetOutputStage().SetDither(true);
+        Report("features", "Sawtooth (output stage + dither)", Measure(audioMixer));
+    }
+
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.GetChorus().SetMode(Chorus::CHORUS);
+        Report("features", "Sawtooth (chorus)", Measure(audioMixer));
+
+        audioMixer.GetChorus().SetMode(Chorus::OFF);
+        audioMixer.GetDelay().SetTime(Delay::MAX_TIME);
+        Report("features", "Sawtooth (delay)", Measure(audioMixer));
+
+        audioMixer.GetChorus().SetMode(Chorus::FLANGER);
+        Report("features", "Sawtooth (flanger + delay)", Measure(audioMixer));
+
+        audioMixer.GetChorus().SetMode(Chorus::OFF);
+        audioMixer.GetDelay().SetTime(0);
+        audioMixer.GetReverb().SetMix(30);
+        Report("features", "Sawtooth (reverb)", Measure(audioMixer));
+    }
+
+    // Unison should cost far less than the same number of separate oscillators
+    for(uint8_t unisonCount : {4, 8, 16})
+    {
+        AudioMixer audioMixer;
+        audioMixer.GetOscillator1().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator2().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator3().SetWaveformType(Sawtooth);
+        audioMixer.GetOscillator1().SetUnisonCount(unisonCount);
+        audioMixer.GetOscillator2().SetUnisonCount(unisonCount);
+        audioMixer.GetOscillator3().SetUnisonCount(unisonCount);
+        Report("features", "Sawtooth (unison x" + std::to_string(unisonCount) + ")", Measure(audioMixer));
+    }
+
+    // The same voices rendered a sample at a time and by each waveform's block loop.  These are per
+    // voice (a voice sample, and a voice's share of a control block).
+    for(uint8_t voiceCount : {1, 3, 4, 8})
+    {
+        std::string voices{std::to_string(voiceCount) + " voice" + (voiceCount > 1 ? "s" : "")};
+        Report("voice-render", "Per voice, per sample (" + voices + ")", MeasureVoices(voiceCount, true),
+            Parameters{{"render", "\"per_sample\""}, {"voice_count", std::to_string(voiceCount)}});
+        Report("voice-render", "Per voice, block loop (" + voices + ")", MeasureVoices(voiceCount, false),
+            Parameters{{"render", "\"block_loop\""}, {"voice_count", std::to_string(voiceCount)}});
+    }
+
+    RunSweeps();
+
+    if(jsonPath != nullptr)
+    {
+        FILE* jsonFile{jsonToStdout ? stdout : std::fopen(jsonPath, "w")};
+        if(jsonFile == nullptr)
+        {
+            std::fprintf(stderr, "Couldn't open %s\n", jsonPath);
+            return EXIT_FAILURE;
+        }
+
+        WriteJSON(jsonFile);
+        if(!jsonToStdout)
+        {
+            std::fclose(jsonFile);
+        }
+    }
+
+    return 0;
+}
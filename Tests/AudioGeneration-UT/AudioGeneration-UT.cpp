@@ -2,89 +2,729 @@
 #include <AudioGeneration/AudioMixer.h>
 #include <AudioGeneration/WaveformTypes.h>
 #include <AudioGeneration-UT/WaveFileWriter.h>
-#include <AudioGeneration-UT/FileMatch.h>
+#include <AudioGeneration-UT/AudioMatch.h>
+#include <AudioGeneration-UT/ThreadPool.h>
+#include <AudioGeneration-UT/ToneAnalysis.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
 
 const std::size_t samplesPerSecond{44100};
 const std::size_t secondsPerAudioSnippet{2};
 const std::size_t samplesPerAudioSnippet{samplesPerSecond * secondsPerAudioSnippet};
 
+// See MIDI message documentation for note index
+const uint8_t c3NoteIndex{48};
+const uint8_t c4NoteIndex{60};
+
+// A change to the render that only moves samples by a step or two here and there (a different
+// rounding, or float ops in another order) still passes.  A test can pass its own tolerance to
+// AudioMatches where its sound is expected to move further.
+const AudioTolerance renderTolerance{4.0, 70.0, 0.5};
+
+// Any change to how the noise is generated gives entirely different samples, so only its spectrum is
+// held to the expected one.  Reseeding the generator moves that by about 1 dB.
+const AudioTolerance noiseTolerance{65535.0, -std::numeric_limits<double>::infinity(), 1.5};
+
+// The same goes for the dither, which moves the samples by up to 4 LSBs, a lot of a quiet signal
+const AudioTolerance ditherTolerance{6.0, 35.0, 1.5};
+
 void WriteWaveFile(const std::string& waveFilename, uint16_t* audioData)
 {
     WaveFileWriter waveFileWriter(waveFilename, samplesPerSecond);
     waveFileWriter.AppendAudioData(audioData, samplesPerAudioSnippet);
 }
 
-TEST_CASE("Audio Generation")
+// Each golden render sets up its own AudioMixer and renders a snippet, which is then compared
+// with the expected one.  They're independent of one another, so they're rendered in parallel.
+struct GoldenRender
+{
+    std::string name;
+    std::string filename;  // The expected audio is the same name with "Expected" on the end
+    std::function<void(AudioMixer&, uint16_t*)> render;
+    AudioTolerance tolerance = renderTolerance;
+};
+
+const std::vector<GoldenRender> goldenRenders
+{
+    {"Default Audio C4", "C4Default.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            audioMixer.SetMIDINote(c4NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Default Audio C3", "C3Default.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Sawtooth Audio C3", "C3Sawtooth.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Sawtooth Octave Audio C3", "C3SawtoothOctaves.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator2.SetSemitone(12);
+            oscillator3.SetWaveformType(Sawtooth);
+            oscillator3.SetSemitone(-12);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Square Fifths Audio C3", "C3SquareFifths.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator2.SetSemitone(7);
+            oscillator3.SetSemitone(7);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Low Pass Filtered Sawtooth Audio C3", "C3SawtoothLowPass.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+
+            StateVariableFilter& filter{audioMixer.GetFilter()};
+            filter.SetMode(LowPass);
+            filter.SetCutoff(72);
+            filter.SetResonance(7);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"LFO Modulated Sawtooth Audio C3", "C3SawtoothLFO.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+
+            StateVariableFilter& filter{audioMixer.GetFilter()};
+            filter.SetMode(LowPass);
+            filter.SetCutoff(72);
+            filter.SetResonance(5);
+
+            // A slow filter sweep plus a little vibrato
+            audioMixer.GetLFO1().SetRate(10);
+            audioMixer.GetLFO2().SetRate(60);
+
+            ModulationMatrix& modulationMatrix{audioMixer.GetModulationMatrix()};
+            modulationMatrix.SetSource(0, ModulationMatrix::LFO_1);
+            modulationMatrix.SetDestination(0, ModulationMatrix::FILTER_CUTOFF);
+            modulationMatrix.SetAmount(0, 40);
+            modulationMatrix.SetSource(1, ModulationMatrix::LFO_2);
+            modulationMatrix.SetDestination(1, ModulationMatrix::PITCH);
+            modulationMatrix.SetAmount(1, 5);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Pulse Width Modulated Band Limited Square Audio C3", "C3SquarePWM.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetPulseWidth(25);
+            oscillator2.SetPulseWidth(25);
+            oscillator3.SetPulseWidth(25);
+
+            oscillator1.SetBandLimited(true);
+            oscillator2.SetBandLimited(true);
+            oscillator3.SetBandLimited(true);
+
+            audioMixer.GetLFO1().SetRate(5);
+
+            ModulationMatrix& modulationMatrix{audioMixer.GetModulationMatrix()};
+            modulationMatrix.SetSource(0, ModulationMatrix::LFO_1);
+            modulationMatrix.SetDestination(0, ModulationMatrix::PULSE_WIDTH);
+            modulationMatrix.SetAmount(0, 40);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Hard Synced Sawtooth Audio C3", "C3SawtoothHardSync.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+            oscillator2.SetSemitone(7);
+            oscillator3.SetSemitone(12);
+
+            audioMixer.SetHardSync(true);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Frequency Modulated Square Audio C3", "C3SquareFM.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            // Oscillator 1 is only heard through the modulation
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator1.SetLevel(0);
+            oscillator1.SetSemitone(12);
+            oscillator3.SetWaveformType(None);
+
+            audioMixer.SetFMAmount(60);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Oversampled Frequency Modulated Square Audio C3", "C3SquareFMOversampled.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            // The same patch as above, rendered at twice the sample rate
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator1.SetLevel(0);
+            oscillator1.SetSemitone(12);
+            oscillator3.SetWaveformType(None);
+
+            audioMixer.SetFMAmount(60);
+            audioMixer.SetOversampling(true);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Unison Sawtooth Audio C3", "C3SawtoothUnison.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator1.SetUnisonCount(7);
+            oscillator1.SetUnisonSpread(25);
+            oscillator2.SetWaveformType(None);
+            oscillator3.SetWaveformType(None);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"White And Pink Noise", "Noise.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Noise);
+            oscillator2.SetWaveformType(PinkNoise);
+            oscillator3.SetWaveformType(None);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }, noiseTolerance},
+
+    {"Level Change Mid Note Sawtooth Audio C3", "C3SawtoothLevelChange.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+
+            // Turning the level down while the note plays should fade over a few blocks, not step
+            const std::size_t halfSnippet{samplesPerAudioSnippet / 2};
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, halfSnippet);
+            oscillator1.SetLevel(3);
+            oscillator2.SetLevel(3);
+            oscillator3.SetLevel(3);
+            audioMixer.GetAudioData(&(audioData[halfSnippet]), samplesPerAudioSnippet - halfSnippet);
+        }},
+
+    {"Legato Glide C3 To C4", "C3ToC4Glide.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+
+            Glide& glide{audioMixer.GetGlide()};
+            glide.SetTime(25);
+
+            // C4 is played while C3 is still held, so it glides up from C3
+            const std::size_t halfSnippet{samplesPerAudioSnippet / 2};
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, halfSnippet);
+            audioMixer.SetMIDINote(c4NoteIndex);
+            audioMixer.GetAudioData(&(audioData[halfSnippet]), samplesPerAudioSnippet - halfSnippet);
+        }},
+
+    {"Output Stage Single Square Audio C3", "C3SquareOutputStage.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            // A lone narrow pulse already spans the DAC's full range and sits well off center, so the
+            // output stage has DC to remove and the gain drives it into the limiter.
+            oscillator1.SetWaveformType(Square);
+            oscillator1.SetPulseWidth(20);
+            oscillator2.SetWaveformType(None);
+            oscillator3.SetWaveformType(None);
+
+            OutputStage& outputStage{audioMixer.GetOutputStage()};
+            outputStage.SetEnabled(true);
+            outputStage.SetGain(12);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Dithered Quiet Low Pass Filtered Sawtooth Audio C3", "C3SawtoothDithered.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+
+            // Filtered right down, so the signal is only a few hundred LSBs and rounding it really
+            // would be audible without the dither.
+            StateVariableFilter& filter{audioMixer.GetFilter()};
+            filter.SetMode(LowPass);
+            filter.SetCutoff(10);
+
+            OutputStage& outputStage{audioMixer.GetOutputStage()};
+            outputStage.SetEnabled(true);
+            outputStage.SetDither(true);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }, ditherTolerance},
+
+    {"Chorus And Delay Released Sawtooth Audio C3", "C3SawtoothChorusDelay.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(None);
+            oscillator3.SetWaveformType(None);
+
+            Chorus& chorus{audioMixer.GetChorus()};
+            chorus.SetMode(Chorus::CHORUS);
+            chorus.SetDepth(100);
+
+            Delay& delay{audioMixer.GetDelay()};
+            delay.SetTime(8);
+            delay.SetFeedback(30);
+            delay.SetMix(30);
+
+            // The echoes pile up past full scale, so the output stage's limiter is needed
+            audioMixer.GetOutputStage().SetEnabled(true);
+
+            // The note's released halfway through, and the echoes carry on ringing after it
+            const std::size_t halfSnippet{samplesPerAudioSnippet / 2};
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, halfSnippet);
+            audioMixer.SetMIDINote(0);
+            audioMixer.GetAudioData(&(audioData[halfSnippet]), samplesPerAudioSnippet - halfSnippet);
+        }},
+
+    {"Reverb Released Square Audio C3", "C3SquareReverb.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Square);
+            oscillator2.SetWaveformType(None);
+            oscillator3.SetWaveformType(None);
+
+            Reverb& reverb{audioMixer.GetReverb()};
+            reverb.SetMix(40);
+            reverb.SetSize(80);
+            audioMixer.GetOutputStage().SetEnabled(true);
+
+            // A short note, so most of the snippet is the reverb's tail
+            const std::size_t noteLength{samplesPerAudioSnippet / 4};
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, noteLength);
+            audioMixer.SetMIDINote(0);
+            audioMixer.GetAudioData(&(audioData[noteLength]), samplesPerAudioSnippet - noteLength);
+        }},
+
+    {"Sample Audio C3", "C3Sample.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            // The second oscillator plays the same sample a fifth up, so it's resampled rather than
+            // played back at its recorded rate, and both run well past the sample into its loop
+            oscillator1.SetWaveformType(Sample);
+            oscillator2.SetWaveformType(Sample);
+            oscillator2.SetSemitone(7);
+            oscillator3.SetWaveformType(None);
+
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        }},
+
+    {"Just Intonation Major Triad C3 Retuned By SysEx", "C3JustTriadRetuned.wav", [](AudioMixer& audioMixer, uint16_t* audioData)
+        {
+            Oscillator& oscillator1{audioMixer.GetOscillator1()};
+            Oscillator& oscillator2{audioMixer.GetOscillator2()};
+            Oscillator& oscillator3{audioMixer.GetOscillator3()};
+
+            oscillator1.SetWaveformType(Sawtooth);
+            oscillator2.SetWaveformType(Sawtooth);
+            oscillator3.SetWaveformType(Sawtooth);
+            oscillator2.SetCent(0);
+            oscillator3.SetCent(0);
+            oscillator2.SetSemitone(4);
+            oscillator3.SetSemitone(7);
+
+            Tuning& tuning{audioMixer.GetTuning()};
+            tuning.SetScale(Tuning::JUST);
+            tuning.SetReferencePitch(432);
+
+            // Halfway through, a real time single note tuning change moves the triad's third (E, which
+            // is key 64 in the message's standard MIDI numbering) to its equal tempered 329.63 Hz
+            const std::size_t halfSnippet{samplesPerAudioSnippet / 2};
+            audioMixer.SetMIDINote(c3NoteIndex);
+            audioMixer.GetAudioData(audioData, halfSnippet);
+            const uint8_t noteChange[]{0xF0, 0x7F, 0x7F, 0x08, 0x02, 0x00, 0x01, 64, 64, 0x00, 0x00, 0xF7};
+            if(!tuning.HandleSysEx(noteChange, sizeof(noteChange)))
+            {
+                throw Exception("The tuning change SysEx was rejected");
+            }
+            audioMixer.GetAudioData(&(audioData[halfSnippet]), samplesPerAudioSnippet - halfSnippet);
+        }}
+};
+
+TEST_CASE("Golden Audio Renders")
 {
-    // See MIDI message documentation for note index
-    const std::size_t c3NoteIndex{48};
-    const std::size_t c4NoteIndex{60};
+    // Every job has its own mixer and buffer.  The mixers are all made here first, as their
+    // constructor rebuilds the note and filter tables they share.
+    std::vector<std::unique_ptr<AudioMixer>> audioMixers;
+    std::vector<std::function<void()>> jobs;
+    for(const GoldenRender& goldenRender : goldenRenders)
+    {
+        audioMixers.emplace_back(new AudioMixer);
+        AudioMixer& audioMixer{*audioMixers.back()};
+        jobs.push_back([&]()
+        {
+            std::vector<uint16_t> audioData(samplesPerAudioSnippet);
+            goldenRender.render(audioMixer, audioData.data());
+            WriteWaveFile(goldenRender.filename, audioData.data());
+        });
+    }
+
+    ThreadPool threadPool;
+    auto startTime{std::chrono::steady_clock::now()};
+    std::vector<ThreadPool::JobResult> results{threadPool.Run(jobs)};
+    std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - startTime};
 
+    // How long each render took and where, so a slow render (or a badly shared out batch) shows up
+    std::ios_base::fmtflags flags{std::cout.flags()};
+    std::streamsize precision{std::cout.precision()};
+    std::size_t threadCount{threadPool.GetThreadCount()};
+    std::cout << std::fixed << std::setprecision(3) << "Golden renders took " << elapsed.count() << " s on "
+              << threadCount << (threadCount == 1 ? " worker" : " workers") << std::endl;
+    for(std::size_t i{0}; i < goldenRenders.size(); ++i)
+    {
+        std::cout << "  " << std::left << std::setw(32) << goldenRenders[i].filename << std::right << std::setw(7)
+                  << results[i].seconds << " s  worker " << results[i].worker << std::endl;
+    }
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+
+    // Checked in the table's order, whichever order they were rendered in
+    for(std::size_t i{0}; i < goldenRenders.size(); ++i)
+    {
+        const GoldenRender& goldenRender{goldenRenders[i]};
+        INFO(goldenRender.name);
+        if(results[i].error)
+        {
+            try
+            {
+                std::rethrow_exception(results[i].error);
+            }
+            catch(const Exception& exception)
+            {
+                FAIL(exception.what());
+            }
+        }
+
+        std::string expectedFilename{goldenRender.filename.substr(0, goldenRender.filename.size() - 4) + "Expected.wav"};
+        CHECK(AudioMatches(goldenRender.filename, expectedFilename, goldenRender.tolerance));
+    }
+}
+
+TEST_CASE("Audio Generation")
+{
     AudioMixer audioMixer;
     uint16_t audioData[samplesPerAudioSnippet];
 
-    SECTION("Default Audio C4")
+    SECTION("Comparison Tolerates Small Differences Only")
     {
-        audioMixer.SetMIDINote(c4NoteIndex);
+        audioMixer.SetMIDINote(c3NoteIndex);
         audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
-        WriteWaveFile("C4Default.wav", audioData);
-        REQUIRE(FilesMatch("C4Default.wav", "C4DefaultExpected.wav"));
+
+        // Every third sample a step off passes the render tolerance, but isn't an exact match.  (A
+        // sample already at the top is left alone, as it would wrap around to the bottom.)
+        for(std::size_t i{0}; i < samplesPerAudioSnippet; i += 3)
+        {
+            if(audioData[i] < UINT16_MAX)
+            {
+                ++audioData[i];
+            }
+        }
+        WriteWaveFile("C3DefaultNudged.wav", audioData);
+        REQUIRE(AudioMatches("C3DefaultNudged.wav", "C3DefaultExpected.wav", renderTolerance));
+
+        AudioComparison nudgedComparison{"C3DefaultNudged.wav", "C3DefaultExpected.wav"};
+        REQUIRE(nudgedComparison.GetMaxAbsoluteError() == 1.0);
+        REQUIRE_FALSE(nudgedComparison.Within(exactTolerance));
+
+        // A cent out of tune doesn't pass
+        audioMixer.GetOscillator1().SetCent(1);
+        audioMixer.SetMIDINote(c3NoteIndex);
+        audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
+        WriteWaveFile("C3DefaultDetuned.wav", audioData);
+        AudioComparison detunedComparison{"C3DefaultDetuned.wav", "C3DefaultExpected.wav"};
+        REQUIRE_FALSE(detunedComparison.Within(renderTolerance));
     }
 
-    SECTION("Default Audio C3")
+    SECTION("Streamed 24 Bit And Float Renders Match The 16 Bit One")
     {
+        // Rendered a block at a time, the way a long render would be, straight into the writers
+        WaveFileWriter pcm24Writer("C3Default24Bit.wav", samplesPerSecond, WaveFileWriter::PCM_24_BIT);
+        WaveFileWriter floatWriter("C3DefaultFloat.wav", samplesPerSecond, WaveFileWriter::FLOAT_32_BIT);
+
+        const std::size_t blockSize{256};
         audioMixer.SetMIDINote(c3NoteIndex);
-        audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
-        WriteWaveFile("C3Default.wav", audioData);
-        REQUIRE(FilesMatch("C3Default.wav", "C3DefaultExpected.wav"));
+        for(std::size_t blockStart{0}; blockStart < samplesPerAudioSnippet; blockStart += blockSize)
+        {
+            std::size_t samplesToRender{std::min(blockSize, samplesPerAudioSnippet - blockStart)};
+            audioMixer.GetAudioData(audioData, samplesToRender);
+            pcm24Writer.AppendAudioData(audioData, samplesToRender);
+            floatWriter.AppendAudioData(audioData, samplesToRender);
+        }
+        pcm24Writer.Close();
+        floatWriter.Close();
+
+        REQUIRE(pcm24Writer.GetSampleCount() == samplesPerAudioSnippet);
+        REQUIRE(AudioMatches("C3Default24Bit.wav", "C3DefaultExpected.wav", exactTolerance));
+        REQUIRE(AudioMatches("C3DefaultFloat.wav", "C3DefaultExpected.wav", exactTolerance));
     }
 
-    SECTION("Sawtooth Audio C3")
+    SECTION("An Oscillator's Cent Is Clamped However It's Set")
     {
-        Oscillator& oscillator1{audioMixer.GetOscillator1()};
-        Oscillator& oscillator2{audioMixer.GetOscillator2()};
-        Oscillator& oscillator3{audioMixer.GetOscillator3()};
+        Oscillator constructed{Sawtooth, 10, 500, 0};
+        REQUIRE(constructed.GetCent() == static_cast<int16_t>(Oscillator::MAX_CENT));
 
-        oscillator1.SetWaveformType(Sawtooth);
-        oscillator2.SetWaveformType(Sawtooth);
-        oscillator3.SetWaveformType(Sawtooth);
+        constructed.SetCent(-500);
+        REQUIRE(constructed.GetCent() == static_cast<int16_t>(Oscillator::MIN_CENT));
+    }
 
-        audioMixer.SetMIDINote(c3NoteIndex);
-        audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
-        WriteWaveFile("C3Sawtooth.wav", audioData);
-        REQUIRE(FilesMatch("C3Sawtooth.wav", "C3SawtoothExpected.wav"));
+    SECTION("A Semitone Offset Past Either End Of The Keyboard Doesn't Break The Oscillator")
+    {
+        // The offset note is held at the top or bottom key, and the next note plays as usual
+        const int8_t semitones[]{12, -12};
+        const uint8_t edgeNoteIndexes[]{120, 5};
+        for(std::size_t i{0}; i < 2; ++i)
+        {
+            AudioMixer edgeMixer;
+            edgeMixer.GetOscillator1().SetWaveformType(Sawtooth);
+            edgeMixer.GetOscillator1().SetSemitone(semitones[i]);
+            edgeMixer.GetOscillator2().SetWaveformType(None);
+            edgeMixer.GetOscillator3().SetWaveformType(None);
+
+            edgeMixer.SetMIDINote(edgeNoteIndexes[i]);
+            edgeMixer.GetAudioData(audioData, samplesPerSecond);
+            edgeMixer.SetMIDINote(0);
+            edgeMixer.GetAudioData(audioData, samplesPerSecond);
+            edgeMixer.SetMIDINote(c4NoteIndex);
+            edgeMixer.GetAudioData(audioData, samplesPerSecond);
+
+            INFO("Semitone offset " << static_cast<int>(semitones[i]));
+            uint16_t lowest{*std::min_element(audioData, audioData + samplesPerSecond)};
+            uint16_t highest{*std::max_element(audioData, audioData + samplesPerSecond)};
+            REQUIRE(highest - lowest > 60000);
+        }
     }
 
-    SECTION("Sawtooth Octave Audio C3")
+    SECTION("A Tuning SysEx Retunes The Key It Names In Standard MIDI Numbering")
     {
-        Oscillator& oscillator1{audioMixer.GetOscillator1()};
-        Oscillator& oscillator2{audioMixer.GetOscillator2()};
-        Oscillator& oscillator3{audioMixer.GetOscillator3()};
+        // Key 69 is A440 in the message, and the synth's A440 is a3NoteIndex
+        const uint8_t a3NoteIndex{57};
+        AudioMixer tunedMixer;
+        Tuning& tuning{tunedMixer.GetTuning()};
+        const uint8_t a440Change[]{0xF0, 0x7F, 0x7F, 0x08, 0x02, 0x00, 0x01, 69, 69, 0x00, 0x00, 0xF7};
+        REQUIRE(tuning.HandleSysEx(a440Change, sizeof(a440Change)));
+        REQUIRE(tuning.GetFrequency(a3NoteIndex) == Approx(440.0f));
 
-        oscillator1.SetWaveformType(Sawtooth);
-        oscillator2.SetWaveformType(Sawtooth);
-        oscillator2.SetSemitone(12);
-        oscillator3.SetWaveformType(Sawtooth);
-        oscillator3.SetSemitone(-12);
+        const uint8_t raisedA440Change[]{0xF0, 0x7F, 0x7F, 0x08, 0x02, 0x00, 0x01, 69, 70, 0x00, 0x00, 0xF7};
+        REQUIRE(tuning.HandleSysEx(raisedA440Change, sizeof(raisedA440Change)));
+        REQUIRE(tuning.GetFrequency(a3NoteIndex) == Approx(466.16f).epsilon(0.001));
+        REQUIRE(tuning.GetFrequency(a3NoteIndex + 12) == Approx(880.0f));
+    }
 
+    SECTION("A Note Released With The Output Stage On Stops At The Midpoint")
+    {
+        // The DC blocker centers the note on the DAC's midpoint, so cutting straight to zero when
+        // it's released would be a half scale click.  What's left in the blocker dies away instead.
+        audioMixer.GetOutputStage().SetEnabled(true);
         audioMixer.SetMIDINote(c3NoteIndex);
-        audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
-        WriteWaveFile("C3SawtoothOctaves.wav", audioData);
-        REQUIRE(FilesMatch("C3SawtoothOctaves.wav", "C3SawtoothOctavesExpected.wav"));
+        audioMixer.GetAudioData(audioData, samplesPerSecond);
+        audioMixer.SetMIDINote(0);
+        audioMixer.GetAudioData(audioData, samplesPerSecond);
+
+        uint16_t lowest{*std::min_element(audioData, audioData + samplesPerSecond)};
+        uint16_t highest{*std::max_element(audioData, audioData + samplesPerSecond)};
+        REQUIRE(lowest > 32768 - 4096);
+        REQUIRE(highest < 32768 + 4096);
+        REQUIRE(audioData[samplesPerSecond - 1] == 32768);
     }
 
-    SECTION("Square Fifths Audio C3")
+    SECTION("Silence Is The Midpoint Whichever Path It Comes By")
     {
-        Oscillator& oscillator1{audioMixer.GetOscillator1()};
-        Oscillator& oscillator2{audioMixer.GetOscillator2()};
-        Oscillator& oscillator3{audioMixer.GetOscillator3()};
+        // Nothing processing the mix, so the released note ramps straight down to the midpoint
+        audioMixer.GetOscillator1().SetLevel(3);
+        audioMixer.SetMIDINote(c3NoteIndex);
+        audioMixer.GetAudioData(audioData, samplesPerSecond);
+        audioMixer.SetMIDINote(0);
+        audioMixer.GetAudioData(&(audioData[samplesPerSecond]), samplesPerSecond);
 
-        oscillator2.SetSemitone(7);
-        oscillator3.SetSemitone(7);
+        int32_t largestReleaseStep{0};
+        for(std::size_t i{samplesPerSecond}; i < samplesPerSecond + 512; ++i)
+        {
+            largestReleaseStep = std::max(largestReleaseStep, std::abs(audioData[i] - audioData[i - 1]));
+        }
+        REQUIRE(largestReleaseStep <= 128);
+        REQUIRE(audioData[samplesPerSecond + 512] == 32768);
 
+        // The reverb's tail dies away to the same place, and switching the reverb off once it has
+        // doesn't move it
+        audioMixer.GetReverb().SetMix(40);
         audioMixer.SetMIDINote(c3NoteIndex);
+        audioMixer.GetAudioData(audioData, samplesPerSecond);
+        audioMixer.SetMIDINote(0);
         audioMixer.GetAudioData(audioData, samplesPerAudioSnippet);
-        WriteWaveFile("C3SquareFifths.wav", audioData);
-        REQUIRE(FilesMatch("C3SquareFifths.wav", "C3SquareFifthsExpected.wav"));
+        REQUIRE(audioData[samplesPerAudioSnippet - 1] == 32768);
+
+        audioMixer.GetReverb().SetMix(0);
+        audioMixer.GetAudioData(audioData, samplesPerSecond);
+        REQUIRE(*std::min_element(audioData, audioData + samplesPerSecond) == 32768);
+        REQUIRE(*std::max_element(audioData, audioData + samplesPerSecond) == 32768);
+    }
+}
+
+// Renders a lone sawtooth, in tune, and analyzes it
+ToneAnalysis AnalyzeSawtooth(uint8_t noteIndex, bool bandLimited, bool oversampling)
+{
+    std::unique_ptr<AudioMixer> audioMixer{new AudioMixer};
+    audioMixer->GetOscillator1().SetWaveformType(Sawtooth);
+    audioMixer->GetOscillator1().SetBandLimited(bandLimited);
+    audioMixer->GetOscillator2().SetWaveformType(None);
+    audioMixer->GetOscillator3().SetWaveformType(None);
+    audioMixer->SetOversampling(oversampling);
+    return AnalyzeNote(*audioMixer, noteIndex);
+}
+
+TEST_CASE("Tone Analysis")
+{
+    SECTION("Tones Are Measured At The Levels They Were Made At")
+    {
+        // A 1 kHz sine with its second harmonic 40 dB down and a tone off the harmonic series 60 dB down
+        const double pi{3.14159265358979323846};
+        const double sampleRate{44100.0};
+        std::vector<float> samples(GetAnalysisSampleCount(sampleRate, 1000.0));
+        for(std::size_t i{0}; i < samples.size(); ++i)
+        {
+            double time{static_cast<double>(i) / sampleRate};
+            samples[i] = static_cast<float>(0.5 * std::sin(2.0 * pi * 1000.0 * time) + 0.005 * std::sin(2.0 * pi * 2000.0 * time) +
+                0.0005 * std::sin(2.0 * pi * 1500.0 * time));
+        }
+
+        ToneAnalysis analysis{AnalyzeTone(samples, sampleRate, 1000.0)};
+        REQUIRE(std::abs(analysis.thd - -40.0) < 0.1);
+        REQUIRE(std::abs(analysis.aliasing - -60.0) < 0.1);
+        REQUIRE(std::abs(analysis.thdPlusNoise - -39.96) < 0.1);
+        REQUIRE(analysis.noiseFloor < -100.0);
+    }
+
+    SECTION("Band Limiting And Oversampling Cut A High Sawtooth's Aliasing")
+    {
+        // Measured at about -11 dB plain, -26 dB band limited and -18 dB oversampled (see
+        // AudioGeneration-Analysis for the rest of the range).  The harmonics shouldn't move.
+        const uint8_t c6NoteIndex{84};
+        ToneAnalysis plain{AnalyzeSawtooth(c6NoteIndex, false, false)};
+        ToneAnalysis bandLimited{AnalyzeSawtooth(c6NoteIndex, true, false)};
+        ToneAnalysis oversampled{AnalyzeSawtooth(c6NoteIndex, false, true)};
+
+        REQUIRE(plain.aliasing < -9.0);
+        REQUIRE(bandLimited.aliasing < -24.0);
+        REQUIRE(oversampled.aliasing < -16.0);
+        REQUIRE(bandLimited.aliasing < plain.aliasing - 12.0);
+        REQUIRE(oversampled.aliasing < plain.aliasing - 5.0);
+
+        REQUIRE(std::abs(bandLimited.thd - plain.thd) < 1.5);
+        REQUIRE(std::abs(oversampled.thd - plain.thd) < 1.5);
     }
 }
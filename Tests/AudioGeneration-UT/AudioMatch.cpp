@@ -0,0 +1,198 @@
+#include <AudioGeneration-UT/AudioMatch.h>
+#include <AudioGeneration-UT/WaveFileReader.h>
+#include <AudioGeneration-UT/WaveFileWriter.h>
+#include <AudioGeneration-UT/Spectrum.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+// The reader scales 16 bit samples to -1.0 to 1.0, so this takes them back to sample steps
+const double sampleSteps{32768.0};
+
+// The spectra are averaged over Hann windowed frames that overlap by half.  Bins more than
+// spectrumFloor dB below the expected spectrum's peak are treated as being at the floor, so the
+// difference between two near silent bins doesn't swamp everything else.
+const std::size_t spectrumFrameSize{4096};
+const double spectrumFloor{-100.0};
+
+AudioComparison::AudioComparison(const std::string& actualFilename, const std::string& expectedFilename) :
+    actualFilename_{actualFilename}, expectedFilename_{expectedFilename}, sampleRate_{0}, comparable_{true},
+    maxAbsoluteError_{0.0}, maxAbsoluteErrorPosition_{0}, signalToNoise_{std::numeric_limits<double>::infinity()},
+    spectralDifference_{0.0}
+{
+    WaveFileReader actualReader{actualFilename_};
+    WaveFileReader expectedReader{expectedFilename_};
+    actual_ = actualReader.GetSamples();
+    expected_ = expectedReader.GetSamples();
+    sampleRate_ = expectedReader.GetSampleRate();
+
+    if(actualReader.GetSampleRate() != expectedReader.GetSampleRate())
+    {
+        comparable_ = false;
+        incomparableReason_ = "the sample rates differ";
+        return;
+    }
+
+    if(actual_.size() != expected_.size())
+    {
+        comparable_ = false;
+        incomparableReason_ = "the lengths differ (" + std::to_string(actual_.size()) + " samples, expected " +
+                              std::to_string(expected_.size()) + ")";
+        return;
+    }
+
+    CompareSamples();
+    CompareSpectra();
+}
+
+bool AudioComparison::GetComparable()
+{
+    return comparable_;
+}
+
+double AudioComparison::GetMaxAbsoluteError()
+{
+    return maxAbsoluteError_;
+}
+
+std::size_t AudioComparison::GetMaxAbsoluteErrorPosition()
+{
+    return maxAbsoluteErrorPosition_;
+}
+
+double AudioComparison::GetSignalToNoise()
+{
+    return signalToNoise_;
+}
+
+double AudioComparison::GetSpectralDifference()
+{
+    return spectralDifference_;
+}
+
+bool AudioComparison::Within(const AudioTolerance& tolerance)
+{
+    return comparable_ && maxAbsoluteError_ <= tolerance.maxAbsoluteError &&
+           signalToNoise_ >= tolerance.minSignalToNoise && spectralDifference_ <= tolerance.maxSpectralDifference;
+}
+
+std::string AudioComparison::GetReport(const AudioTolerance& tolerance)
+{
+    std::ostringstream report;
+    report << actualFilename_ << " against " << expectedFilename_ << ": ";
+
+    if(!comparable_)
+    {
+        report << "can't be compared as " << incomparableReason_;
+        return report.str();
+    }
+
+    report << "max error " << maxAbsoluteError_ << " (limit " << tolerance.maxAbsoluteError << ") at sample "
+           << maxAbsoluteErrorPosition_ << ", SNR " << signalToNoise_ << " dB (limit " << tolerance.minSignalToNoise
+           << "), spectral difference " << spectralDifference_ << " dB (limit " << tolerance.maxSpectralDifference << ")";
+    return report.str();
+}
+
+void AudioComparison::WriteDifference(const std::string& filename)
+{
+    std::vector<uint16_t> difference(comparable_ ? actual_.size() : 0);
+    for(std::size_t i{0}; i < difference.size(); ++i)
+    {
+        // WaveFileWriter takes the synth's unsigned samples, so the difference sits around the middle
+        double value{std::floor((actual_[i] - expected_[i]) * sampleSteps + 0.5) + sampleSteps};
+        if(value < 0.0) { value = 0.0; }
+        else if(value > 2.0 * sampleSteps - 1.0) { value = 2.0 * sampleSteps - 1.0; }
+        difference[i] = static_cast<uint16_t>(value);
+    }
+
+    WaveFileWriter waveFileWriter(filename, sampleRate_);
+    waveFileWriter.AppendAudioData(difference.data(), difference.size());
+}
+
+// The noise is the difference between the files, and the signal is the expected audio with its DC
+// offset taken out (the synth's output sits well above zero, which would flatter the SNR).
+void AudioComparison::CompareSamples()
+{
+    double mean{0.0};
+    for(float sample : expected_)
+    {
+        mean += sample;
+    }
+    mean /= static_cast<double>(expected_.empty() ? 1 : expected_.size());
+
+    double signalPower{0.0};
+    double noisePower{0.0};
+    for(std::size_t i{0}; i < expected_.size(); ++i)
+    {
+        double error{(static_cast<double>(actual_[i]) - expected_[i]) * sampleSteps};
+        double absoluteError{std::fabs(error)};
+        if(absoluteError > maxAbsoluteError_)
+        {
+            maxAbsoluteError_ = absoluteError;
+            maxAbsoluteErrorPosition_ = i;
+        }
+
+        double signal{(expected_[i] - mean) * sampleSteps};
+        signalPower += signal * signal;
+        noisePower += error * error;
+    }
+
+    if(noisePower > 0.0)
+    {
+        signalToNoise_ = 10.0 * std::log10(signalPower / noisePower);
+    }
+}
+
+void AudioComparison::CompareSpectra()
+{
+    std::vector<double> actualPower{GetPowerSpectrum(actual_, spectrumFrameSize, HANN_WINDOW)};
+    std::vector<double> expectedPower{GetPowerSpectrum(expected_, spectrumFrameSize, HANN_WINDOW)};
+
+    double peakPower{0.0};
+    for(double binPower : expectedPower)
+    {
+        if(binPower > peakPower)
+        {
+            peakPower = binPower;
+        }
+    }
+
+    if(peakPower <= 0.0)
+    {
+        peakPower = 1.0;
+    }
+
+    double sumOfSquares{0.0};
+    for(std::size_t bin{0}; bin < expectedPower.size(); ++bin)
+    {
+        double actualLevel{std::max(10.0 * std::log10(actualPower[bin] / peakPower + 1.0e-30), spectrumFloor)};
+        double expectedLevel{std::max(10.0 * std::log10(expectedPower[bin] / peakPower + 1.0e-30), spectrumFloor)};
+        sumOfSquares += (actualLevel - expectedLevel) * (actualLevel - expectedLevel);
+    }
+
+    spectralDifference_ = std::sqrt(sumOfSquares / static_cast<double>(expectedPower.size()));
+}
+
+bool AudioMatches(const std::string& actualFilename, const std::string& expectedFilename, const AudioTolerance& tolerance)
+{
+    AudioComparison comparison{actualFilename, expectedFilename};
+    if(comparison.Within(tolerance))
+    {
+        return true;
+    }
+
+    std::string differenceFilename{actualFilename};
+    std::size_t extension{differenceFilename.rfind(".wav")};
+    differenceFilename.insert((extension == std::string::npos) ? differenceFilename.size() : extension, "Diff");
+
+    std::cout << comparison.GetReport(tolerance);
+    if(comparison.GetComparable())
+    {
+        comparison.WriteDifference(differenceFilename);
+        std::cout << ", the difference is in " << differenceFilename;
+    }
+    std::cout << std::endl;
+
+    return false;
+}
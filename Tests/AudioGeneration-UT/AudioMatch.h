@@ -0,0 +1,62 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <limits>
+
+// How far a render may stray from its expected result.  Every limit has to be met.
+struct AudioTolerance
+{
+    double maxAbsoluteError;       // In 16 bit sample steps
+    double minSignalToNoise;       // In dB, with the difference between the files as the noise
+    double maxSpectralDifference;  // The RMS difference between the two spectra, in dB
+};
+
+// Nothing but an identical render passes
+const AudioTolerance exactTolerance{0.0, std::numeric_limits<double>::infinity(), 0.0};
+
+// Compares the decoded audio of two wave files, rather than their bytes, so a change to the render
+// math that sounds the same (a different rounding, say) can still pass.
+class AudioComparison
+{
+    public:
+        AudioComparison(const std::string& actualFilename, const std::string& expectedFilename);
+
+        // False if the files can't be compared at all (a different sample rate or length)
+        bool GetComparable();
+
+        double GetMaxAbsoluteError();
+        std::size_t GetMaxAbsoluteErrorPosition();
+        double GetSignalToNoise();
+        double GetSpectralDifference();
+
+        bool Within(const AudioTolerance& tolerance);
+
+        // What was compared and how it measured up against the tolerance
+        std::string GetReport(const AudioTolerance& tolerance);
+
+        // Writes the actual audio minus the expected audio as a 16 bit wave file
+        void WriteDifference(const std::string& filename);
+
+    private:
+        void CompareSamples();
+        void CompareSpectra();
+
+        std::string actualFilename_;
+        std::string expectedFilename_;
+        std::vector<float> actual_;
+        std::vector<float> expected_;
+        std::size_t sampleRate_;
+        bool comparable_;
+        std::string incomparableReason_;
+
+        double maxAbsoluteError_;
+        std::size_t maxAbsoluteErrorPosition_;
+        double signalToNoise_;
+        double spectralDifference_;
+};
+
+// Compares the files, and when they aren't within the tolerance prints why and writes the difference
+// next to the actual file (C3Default.wav's goes to C3DefaultDiff.wav).
+bool AudioMatches(const std::string& actualFilename, const std::string& expectedFilename,
+                  const AudioTolerance& tolerance = exactTolerance);
@@ -1,5 +0,0 @@
-#pragma once
-
-#include <string>
-
-bool FilesMatch(const std::string& fileA, const std::string& fileB);
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <AudioGeneration-UT/Spectrum.h>
+#include <cmath>
+#include <utility>
+
+const double pi{3.14159265358979323846};
+
+void FFT(std::vector<std::complex<double>>& values)
+{
+    const std::size_t size{values.size()};
+
+    for(std::size_t i{1}, j{0}; i < size; ++i)
+    {
+        std::size_t bit{size >> 1};
+        for(; j & bit; bit >>= 1)
+        {
+            j ^= bit;
+        }
+        j ^= bit;
+
+        if(i < j)
+        {
+            std::swap(values[i], values[j]);
+        }
+    }
+
+    for(std::size_t length{2}; length <= size; length <<= 1)
+    {
+        std::complex<double> step{std::polar(1.0, -2.0 * pi / static_cast<double>(length))};
+        for(std::size_t start{0}; start < size; start += length)
+        {
+            std::complex<double> twiddle{1.0, 0.0};
+            for(std::size_t k{0}; k < length / 2; ++k)
+            {
+                std::complex<double> even{values[start + k]};
+                std::complex<double> odd{values[start + k + length / 2] * twiddle};
+                values[start + k] = even + odd;
+                values[start + k + length / 2] = even - odd;
+                twiddle *= step;
+            }
+        }
+    }
+}
+
+std::vector<double> GetWindow(std::size_t frameSize, SpectrumWindow window)
+{
+    std::vector<double> weights(frameSize);
+    for(std::size_t i{0}; i < frameSize; ++i)
+    {
+        double phase{2.0 * pi * static_cast<double>(i) / static_cast<double>(frameSize)};
+        if(window == HANN_WINDOW)
+        {
+            weights[i] = 0.5 - 0.5 * std::cos(phase);
+        }
+        else
+        {
+            weights[i] = 0.35875 - 0.48829 * std::cos(phase) + 0.14128 * std::cos(2.0 * phase) - 0.01168 * std::cos(3.0 * phase);
+        }
+    }
+
+    return weights;
+}
+
+std::vector<double> GetPowerSpectrum(const std::vector<float>& samples, std::size_t frameSize, SpectrumWindow window)
+{
+    const std::vector<double> weights{GetWindow(frameSize, window)};
+    std::vector<double> power(frameSize / 2 + 1, 0.0);
+    std::vector<std::complex<double>> frame(frameSize);
+    std::size_t frameCount{0};
+
+    for(std::size_t start{0}; start + frameSize <= samples.size(); start += frameSize / 2)
+    {
+        for(std::size_t i{0}; i < frameSize; ++i)
+        {
+            frame[i] = std::complex<double>{weights[i] * samples[start + i], 0.0};
+        }
+
+        FFT(frame);
+        for(std::size_t bin{0}; bin < power.size(); ++bin)
+        {
+            power[bin] += std::norm(frame[bin]);
+        }
+        ++frameCount;
+    }
+
+    for(double& binPower : power)
+    {
+        binPower /= static_cast<double>(frameCount ? frameCount : 1);
+    }
+
+    return power;
+}
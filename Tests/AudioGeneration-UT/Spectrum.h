@@ -0,0 +1,20 @@
+#pragma once
+
+#include <complex>
+#include <vector>
+
+// The window applied to each frame before it's transformed.  Hann is fine for comparing two
+// spectra.  Blackman-Harris (four term) has a wider main lobe, but its side lobes are over 90 dB
+// down, so a loud harmonic doesn't hide a quiet tone a few bins away.
+enum SpectrumWindow
+{
+    HANN_WINDOW,
+    BLACKMAN_HARRIS_WINDOW
+};
+
+// An in place radix-2 FFT (the size has to be a power of two)
+void FFT(std::vector<std::complex<double>>& values);
+
+// The average power in each bin (frameSize / 2 + 1 of them) over every whole frame of the samples,
+// with the frames overlapping by half.  The frame size has to be a power of two.
+std::vector<double> GetPowerSpectrum(const std::vector<float>& samples, std::size_t frameSize, SpectrumWindow window);
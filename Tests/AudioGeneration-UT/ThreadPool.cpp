@@ -0,0 +1,127 @@
+#include <AudioGeneration-UT/ThreadPool.h>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// The workers' queues are private to the pool (this file is built into more than one target, so
+// nothing generic here should be visible outside it)
+namespace
+{
+
+// One worker's share of the jobs, as indexes into the batch
+struct WorkQueue
+{
+    std::mutex mutex;
+    std::deque<std::size_t> jobIndexes;
+};
+
+// Takes the next job from the worker's own queue, or failing that steals one from another's.
+// Jobs never add jobs, so once every queue is empty the batch is done.
+bool TakeJob(std::vector<std::unique_ptr<WorkQueue>>& queues, std::size_t worker, std::size_t& jobIndex)
+{
+    {
+        WorkQueue& ownQueue{*queues[worker]};
+        std::lock_guard<std::mutex> lock{ownQueue.mutex};
+        if(!ownQueue.jobIndexes.empty())
+        {
+            jobIndex = ownQueue.jobIndexes.back();
+            ownQueue.jobIndexes.pop_back();
+            return true;
+        }
+    }
+
+    for(std::size_t offset{1}; offset < queues.size(); ++offset)
+    {
+        WorkQueue& victimQueue{*queues[(worker + offset) % queues.size()]};
+        std::lock_guard<std::mutex> lock{victimQueue.mutex};
+        if(!victimQueue.jobIndexes.empty())
+        {
+            jobIndex = victimQueue.jobIndexes.front();
+            victimQueue.jobIndexes.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+}
+
+ThreadPool::ThreadPool(std::size_t threadCount) : threadCount_{threadCount}
+{
+    if(threadCount_ == 0)
+    {
+        threadCount_ = std::thread::hardware_concurrency();
+    }
+
+    if(threadCount_ == 0)
+    {
+        threadCount_ = 1;
+    }
+}
+
+std::size_t ThreadPool::GetThreadCount()
+{
+    return threadCount_;
+}
+
+std::vector<ThreadPool::JobResult> ThreadPool::Run(const std::vector<std::function<void()>>& jobs)
+{
+    std::vector<JobResult> results(jobs.size(), JobResult{nullptr, 0.0, 0});
+    const std::size_t workerCount{std::min(threadCount_, jobs.size())};
+    if(workerCount == 0)
+    {
+        return results;
+    }
+
+    // Each worker starts with a contiguous run of the jobs.  It works backward through them while
+    // thieves take from the front, so the two only meet at the last job.
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    for(std::size_t worker{0}; worker < workerCount; ++worker)
+    {
+        queues.emplace_back(new WorkQueue);
+        for(std::size_t i{jobs.size() * worker / workerCount}; i < jobs.size() * (worker + 1) / workerCount; ++i)
+        {
+            queues.back()->jobIndexes.push_back(i);
+        }
+    }
+
+    auto work = [&](std::size_t worker)
+    {
+        std::size_t jobIndex;
+        while(TakeJob(queues, worker, jobIndex))
+        {
+            auto startTime{std::chrono::steady_clock::now()};
+            try
+            {
+                jobs[jobIndex]();
+            }
+            catch(...)
+            {
+                results[jobIndex].error = std::current_exception();
+            }
+
+            std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - startTime};
+            results[jobIndex].seconds = elapsed.count();
+            results[jobIndex].worker = worker;
+        }
+    };
+
+    // The calling thread is the first worker
+    std::vector<std::thread> threads;
+    for(std::size_t worker{1}; worker < workerCount; ++worker)
+    {
+        threads.emplace_back(work, worker);
+    }
+    work(0);
+
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    return results;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <exception>
+#include <functional>
+#include <vector>
+
+// Runs a batch of independent jobs across the machine's cores.  Each worker starts with its own
+// share of the jobs and works through them from the back, and when it runs out it steals from the
+// front of another worker's share.  So one slow job doesn't hold up the jobs queued behind it, and
+// the workers all finish at about the same time.
+//
+// The jobs mustn't share anything they change (each render job has its own AudioMixer).  Results
+// come back in the order the jobs were given, however they happened to run.
+class ThreadPool
+{
+    public:
+        struct JobResult
+        {
+            std::exception_ptr error;  // Whatever the job threw, if anything
+            double seconds;            // How long the job took
+            std::size_t worker;        // Which worker ran it
+        };
+
+        // Zero threads means one per core
+        ThreadPool(std::size_t threadCount = 0);
+
+        std::size_t GetThreadCount();
+
+        // Returns once every job has finished
+        std::vector<JobResult> Run(const std::vector<std::function<void()>>& jobs);
+
+    private:
+        std::size_t threadCount_;
+};
@@ -0,0 +1,135 @@
+#include <AudioGeneration-UT/ToneAnalysis.h>
+#include <AudioGeneration-UT/Spectrum.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <AudioGeneration/AudioMixer.h>
+#include <AudioGeneration/AudioSettings.h>
+#include <algorithm>
+#include <cmath>
+
+// Bins within this many of a harmonic are part of it.  The Blackman-Harris window's main lobe is
+// four bins either side, and one more allows for the harmonic falling between bins.
+const std::size_t harmonicHalfWidth{5};
+
+// The frames are made long enough that the harmonics are this many bins apart, leaving most of the
+// spectrum between them to look for aliasing in
+const double binsPerHarmonic{32.0};
+const std::size_t minimumFrameSize{4096};
+
+// The analysis averages this many frames, overlapping by half.  That steadies the noise in each bin
+// enough that a bin spurFactor times the floor's power is a tone rather than noise.
+const std::size_t analysisFrameCount{15};
+const double spurFactor{4.0};
+
+// Lets the level smoothing and oversampling filter settle before the analysis starts
+const double settleSeconds{0.25};
+
+const double minimumLevel{-200.0};
+
+std::size_t GetFrameSize(double sampleRate, double fundamentalFrequency)
+{
+    std::size_t frameSize{minimumFrameSize};
+    while(static_cast<double>(frameSize) < binsPerHarmonic * sampleRate / fundamentalFrequency)
+    {
+        frameSize <<= 1;
+    }
+
+    return frameSize;
+}
+
+double ToDecibels(double powerRatio)
+{
+    return (powerRatio > 0.0) ? std::max(10.0 * std::log10(powerRatio), minimumLevel) : minimumLevel;
+}
+
+std::size_t GetAnalysisSampleCount(double sampleRate, double fundamentalFrequency)
+{
+    return GetFrameSize(sampleRate, fundamentalFrequency) * (analysisFrameCount + 1) / 2;
+}
+
+ToneAnalysis AnalyzeTone(const std::vector<float>& samples, double sampleRate, double fundamentalFrequency)
+{
+    if(fundamentalFrequency <= 0.0 || fundamentalFrequency >= sampleRate / 2.0)
+    {
+        throw Exception("The fundamental has to be between 0 Hz and Nyquist to analyze a tone");
+    }
+
+    const std::size_t frameSize{GetFrameSize(sampleRate, fundamentalFrequency)};
+    if(samples.size() < GetAnalysisSampleCount(sampleRate, fundamentalFrequency))
+    {
+        throw Exception("Too few samples to analyze a " + std::to_string(fundamentalFrequency) + " Hz tone");
+    }
+
+    const std::vector<double> power{GetPowerSpectrum(samples, frameSize, BLACKMAN_HARRIS_WINDOW)};
+    const double binWidth{sampleRate / static_cast<double>(frameSize)};
+
+    double fundamentalPower{0.0};
+    double harmonicPower{0.0};
+    double offSeriesPower{0.0};
+    std::vector<double> offSeries;
+    for(std::size_t bin{harmonicHalfWidth + 1}; bin < power.size(); ++bin)
+    {
+        double frequency{static_cast<double>(bin) * binWidth};
+        double harmonic{std::round(frequency / fundamentalFrequency)};
+        if(harmonic >= 1.0 && std::abs(frequency - harmonic * fundamentalFrequency) <= static_cast<double>(harmonicHalfWidth) * binWidth)
+        {
+            (harmonic == 1.0 ? fundamentalPower : harmonicPower) += power[bin];
+        }
+        else
+        {
+            offSeriesPower += power[bin];
+            offSeries.push_back(power[bin]);
+        }
+    }
+
+    if(fundamentalPower <= 0.0)
+    {
+        throw Exception("There's no fundamental at " + std::to_string(fundamentalFrequency) + " Hz to analyze");
+    }
+
+    double floorPower{0.0};
+    if(!offSeries.empty())
+    {
+        std::vector<double> sorted{offSeries};
+        std::nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+        floorPower = sorted[sorted.size() / 2];
+    }
+
+    double spurPower{0.0};
+    for(double binPower : offSeries)
+    {
+        if(binPower > spurFactor * floorPower)
+        {
+            spurPower += binPower - floorPower;
+        }
+    }
+
+    ToneAnalysis analysis;
+    analysis.fundamentalFrequency = fundamentalFrequency;
+    analysis.thd = ToDecibels(harmonicPower / fundamentalPower);
+    analysis.thdPlusNoise = ToDecibels((harmonicPower + offSeriesPower) / fundamentalPower);
+    analysis.aliasing = ToDecibels(spurPower / fundamentalPower);
+    analysis.noiseFloor = ToDecibels(floorPower * static_cast<double>(power.size() - harmonicHalfWidth - 1) / fundamentalPower);
+    return analysis;
+}
+
+ToneAnalysis AnalyzeNote(AudioMixer& audioMixer, uint8_t noteIndex)
+{
+    const double sampleRate{SAMPLE_RATE};
+    const double fundamentalFrequency{audioMixer.GetTuning().GetFrequency(noteIndex)};
+
+    audioMixer.SetMIDINote(noteIndex);
+    std::vector<uint16_t> audioData(static_cast<std::size_t>(settleSeconds * sampleRate));
+    audioMixer.GetAudioData(audioData.data(), static_cast<uint32_t>(audioData.size()));
+
+    audioData.resize(GetAnalysisSampleCount(sampleRate, fundamentalFrequency));
+    audioMixer.GetAudioData(audioData.data(), static_cast<uint32_t>(audioData.size()));
+
+    // DAC codes are centered on 32768
+    std::vector<float> samples(audioData.size());
+    for(std::size_t i{0}; i < audioData.size(); ++i)
+    {
+        samples[i] = (static_cast<float>(audioData[i]) - 32768.0f) / 32768.0f;
+    }
+
+    return AnalyzeTone(samples, sampleRate, fundamentalFrequency);
+}
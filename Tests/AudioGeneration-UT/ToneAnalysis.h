@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+class AudioMixer;
+
+// What a steady tone's spectrum is made of.  The levels are all in dB relative to the fundamental,
+// so lower is cleaner.  (THD is mostly the waveform's own harmonics, so it's there to be compared
+// between renders of the same waveform rather than held to a target.)
+//
+// A bin belongs to a harmonic when it's within the window's main lobe of a multiple of the
+// fundamental.  Everything else, apart from DC, is off the harmonic series.  For an oscillator
+// that's aliasing (harmonics above Nyquist folded back down) plus noise, and the two are told
+// apart by level: the floor is the median bin off the series, and whatever stands well above it is
+// counted as aliasing.
+struct ToneAnalysis
+{
+    double fundamentalFrequency;  // In Hz
+    double thd;                   // Harmonics 2 and up, below Nyquist
+    double thdPlusNoise;          // Everything but the fundamental and DC
+    double aliasing;              // Tones off the harmonic series, less the floor under them
+    double noiseFloor;            // The floor's level as if it filled the whole band
+};
+
+// The samples should be a steady tone at the given fundamental, scaled to -1.0 to 1.0.  It takes a
+// few frames' worth (see GetAnalysisSampleCount), and throws if there aren't enough.
+ToneAnalysis AnalyzeTone(const std::vector<float>& samples, double sampleRate, double fundamentalFrequency);
+
+// Enough samples for AnalyzeTone to resolve every harmonic of the fundamental
+std::size_t GetAnalysisSampleCount(double sampleRate, double fundamentalFrequency);
+
+// Plays the note on the mixer as it's set up, lets it settle, and analyzes what it renders.  The
+// fundamental's taken from the mixer's tuning, so the oscillators shouldn't be detuned.
+ToneAnalysis AnalyzeNote(AudioMixer& audioMixer, uint8_t noteIndex);
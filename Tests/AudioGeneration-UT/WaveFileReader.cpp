@@ -0,0 +1,194 @@
+#include <AudioGeneration-UT/WaveFileReader.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <fstream>
+#include <cstring>
+
+namespace
+{
+
+// Wave files are little endian whatever the machine is
+uint32_t ReadLittleEndian(const char* bytes, std::size_t byteCount)
+{
+    uint32_t value{0};
+    for(std::size_t i{0}; i < byteCount; ++i)
+    {
+        value |= static_cast<uint32_t>(static_cast<uint8_t>(bytes[i])) << (8 * i);
+    }
+
+    return value;
+}
+
+}
+
+WaveFileReader::WaveFileReader(const std::string& filename) :
+    filename_{filename}, sampleRate_{0}, channels_{0}, bitsPerSample_{0}, floatingPoint_{false}, formatRead_{false},
+    hasLoop_{false}, loopStart_{0}, loopEnd_{0}
+{
+    std::ifstream fileStream(filename_, std::ios::in | std::ios::binary);
+    if(!fileStream.is_open())
+    {
+        throw Exception("Failed to open wave file " + filename_);
+    }
+
+    char riffHeader[12];
+    fileStream.read(riffHeader, sizeof(riffHeader));
+    if(!fileStream.good() || std::memcmp(riffHeader, "RIFF", 4) != 0 || std::memcmp(&(riffHeader[8]), "WAVE", 4) != 0)
+    {
+        throw Exception(filename_ + " isn't a wave file");
+    }
+
+    // The chunks can come in any order, but the fmt chunk has to be read before the data is decoded
+    std::vector<char> dataChunk;
+    bool dataFound{false};
+
+    char chunkHeader[8];
+    while(fileStream.read(chunkHeader, sizeof(chunkHeader)))
+    {
+        std::size_t chunkSize{ReadLittleEndian(&(chunkHeader[4]), 4)};
+        std::vector<char> chunk(chunkSize);
+        fileStream.read(chunk.data(), chunkSize);
+        if(!fileStream.good())
+        {
+            // WaveFileWriter's files are only cut short if it was never closed
+            throw Exception(filename_ + " is truncated");
+        }
+
+        // Chunks are padded to an even size
+        if(chunkSize % 2)
+        {
+            fileStream.ignore(1);
+        }
+
+        if(std::memcmp(chunkHeader, "fmt ", 4) == 0) { ReadFormatChunk(chunk); }
+        else if(std::memcmp(chunkHeader, "smpl", 4) == 0) { ReadSampleChunk(chunk); }
+        else if(std::memcmp(chunkHeader, "data", 4) == 0)
+        {
+            dataChunk.swap(chunk);
+            dataFound = true;
+        }
+    }
+
+    if(!formatRead_ || !dataFound)
+    {
+        throw Exception(filename_ + " has no fmt or data chunk");
+    }
+
+    ReadDataChunk(dataChunk);
+}
+
+std::size_t WaveFileReader::GetSampleRate()
+{
+    return sampleRate_;
+}
+
+uint16_t WaveFileReader::GetBitsPerSample()
+{
+    return bitsPerSample_;
+}
+
+bool WaveFileReader::GetFloatingPoint()
+{
+    return floatingPoint_;
+}
+
+const std::vector<float>& WaveFileReader::GetSamples()
+{
+    return samples_;
+}
+
+bool WaveFileReader::HasLoop()
+{
+    return hasLoop_;
+}
+
+std::size_t WaveFileReader::GetLoopStart()
+{
+    return loopStart_;
+}
+
+std::size_t WaveFileReader::GetLoopEnd()
+{
+    return loopEnd_;
+}
+
+// See WaveFileWriter::WriteWaveHeader for the layout
+void WaveFileReader::ReadFormatChunk(const std::vector<char>& chunk)
+{
+    if(chunk.size() < 16)
+    {
+        throw Exception(filename_ + " has a short fmt chunk");
+    }
+
+    uint16_t audioFormat{static_cast<uint16_t>(ReadLittleEndian(&(chunk[0]), 2))};
+    channels_ = static_cast<uint16_t>(ReadLittleEndian(&(chunk[2]), 2));
+    sampleRate_ = ReadLittleEndian(&(chunk[4]), 4);
+    bitsPerSample_ = static_cast<uint16_t>(ReadLittleEndian(&(chunk[14]), 2));
+
+    // The extensible format keeps the real format in the first two bytes of its sub format GUID
+    if(audioFormat == EXTENSIBLE_AUDIO_FORMAT && chunk.size() >= 26)
+    {
+        audioFormat = static_cast<uint16_t>(ReadLittleEndian(&(chunk[24]), 2));
+    }
+
+    floatingPoint_ = (audioFormat == FLOAT_AUDIO_FORMAT);
+
+    bool supported{(audioFormat == PCM_AUDIO_FORMAT && (bitsPerSample_ == 8 || bitsPerSample_ == 16 || bitsPerSample_ == 24 || bitsPerSample_ == 32)) ||
+                   (floatingPoint_ && bitsPerSample_ == 32)};
+    if(!supported || channels_ == 0)
+    {
+        throw Exception(filename_ + " is in an unsupported wave format");
+    }
+
+    formatRead_ = true;
+}
+
+void WaveFileReader::ReadDataChunk(const std::vector<char>& chunk)
+{
+    const std::size_t bytesPerSample{static_cast<std::size_t>(bitsPerSample_ / 8)};
+    const std::size_t frameCount{chunk.size() / (bytesPerSample * channels_)};
+    samples_.resize(frameCount);
+
+    for(std::size_t frame{0}; frame < frameCount; ++frame)
+    {
+        float sum{0.0f};
+        for(std::size_t channel{0}; channel < channels_; ++channel)
+        {
+            const char* bytes{&(chunk[(frame * channels_ + channel) * bytesPerSample])};
+            uint32_t raw{ReadLittleEndian(bytes, bytesPerSample)};
+
+            if(floatingPoint_)
+            {
+                float value;
+                std::memcpy(&value, &raw, sizeof(value));
+                sum += value;
+            }
+            else if(bytesPerSample == 1)
+            {
+                // 8 bit wave files are unsigned
+                sum += (static_cast<float>(raw) - 128.0f) / 128.0f;
+            }
+            else
+            {
+                // Shift the sample up to the top of 32 bits so its sign comes along
+                int32_t value{static_cast<int32_t>(raw << (32 - bitsPerSample_))};
+                sum += static_cast<float>(value) / 2147483648.0f;
+            }
+        }
+
+        samples_[frame] = sum / static_cast<float>(channels_);
+    }
+}
+
+// The smpl chunk's fixed part is 36 bytes, followed by 24 bytes for each loop
+void WaveFileReader::ReadSampleChunk(const std::vector<char>& chunk)
+{
+    if(chunk.size() < 36 + 24 || ReadLittleEndian(&(chunk[28]), 4) == 0)
+    {
+        return;
+    }
+
+    // The smpl chunk's loop end is the last sample played, rather than one past it
+    loopStart_ = ReadLittleEndian(&(chunk[36 + 8]), 4);
+    loopEnd_ = ReadLittleEndian(&(chunk[36 + 12]), 4) + 1;
+    hasLoop_ = true;
+}
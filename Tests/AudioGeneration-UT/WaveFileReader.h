@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+// Reads a wave file back in, the reverse of WaveFileWriter.  Rather than assuming the 44 byte
+// header WaveFileWriter writes, it walks the RIFF chunks, so it also reads files from other tools:
+// 8, 16, 24 and 32 bit PCM or 32 bit float, any number of channels (mixed down to mono) and the
+// first loop of a "smpl" chunk if there is one.
+class WaveFileReader
+{
+    public:
+        WaveFileReader(const std::string& filename);
+
+        std::size_t GetSampleRate();
+        uint16_t GetBitsPerSample();
+        bool GetFloatingPoint();
+
+        // The samples, mixed down to mono and scaled to -1.0 to 1.0
+        const std::vector<float>& GetSamples();
+
+        // The loop from the smpl chunk, if any.  The end is exclusive.
+        bool HasLoop();
+        std::size_t GetLoopStart();
+        std::size_t GetLoopEnd();
+
+    private:
+        void ReadFormatChunk(const std::vector<char>& chunk);
+        void ReadDataChunk(const std::vector<char>& chunk);
+        void ReadSampleChunk(const std::vector<char>& chunk);
+
+        std::string filename_;
+        std::size_t sampleRate_;
+        uint16_t channels_;
+        uint16_t bitsPerSample_;
+        bool floatingPoint_;
+        bool formatRead_;
+        std::vector<float> samples_;
+        bool hasLoop_;
+        std::size_t loopStart_;
+        std::size_t loopEnd_;
+
+        static const uint16_t PCM_AUDIO_FORMAT{1};
+        static const uint16_t FLOAT_AUDIO_FORMAT{3};
+        static const uint16_t EXTENSIBLE_AUDIO_FORMAT{0xFFFE};
+};
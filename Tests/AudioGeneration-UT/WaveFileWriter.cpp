@@ -1,8 +1,27 @@
 #include <AudioGeneration-UT/WaveFileWriter.h>
 #include <AudioGeneration-UT/Exception.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
 
-WaveFileWriter::WaveFileWriter(const std::string& filename, std::size_t sampleRate) :
-    filename_{filename}, sampleRate_{sampleRate}, sampleCount_{0}
+namespace
+{
+
+// Wave files are little endian whatever the machine is
+void WriteLittleEndian(std::vector<char>& bytes, uint32_t value, std::size_t byteCount)
+{
+    for(std::size_t i{0}; i < byteCount; ++i)
+    {
+        bytes.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+}
+
+WaveFileWriter::WaveFileWriter(const std::string& filename, std::size_t sampleRate, Format format) :
+    filename_{filename}, sampleRate_{sampleRate}, format_{format}, bytesPerSample_{(format == PCM_16_BIT) ? 2u : ((format == PCM_24_BIT) ? 3u : 4u)},
+    sampleCount_{0}, closed_{false}, writeBuffer_(WRITE_BUFFER_SIZE), writeBufferUsed_{0}, dataSizePosition_{0},
+    factSampleCountPosition_{0}
 {
     fileStream_.open(filename_, std::ios::out | std::ios::binary);
     if(!fileStream_.is_open())
@@ -10,48 +29,120 @@ WaveFileWriter::WaveFileWriter(const std::string& filename, std::size_t sampleRa
         throw Exception("Failed to open wave file for writing");
     }
 
-    // Write some blank space for the wave header. (The actual wave header will be written when the file is closed as 
-    // we don't know some of the values until we're ready to close the file).
-    uint8_t blankSpace[sizeof(WaveHeader)];
-     fileStream_.write(reinterpret_cast<const char*>(blankSpace), sizeof(WaveHeader)); 
-    if(!fileStream_.good())
-    {
-        throw Exception("Failed to write blank data to wave file header");
-    }
+    // The header goes out now with the sizes left at zero, to be patched on close
+    WriteWaveHeader();
 }
 
 WaveFileWriter::~WaveFileWriter()
 {
-    WriteWaveHeader();
-
-    fileStream_.close();
+    // A destructor mustn't throw, so a failure here just leaves a file the reader calls truncated
+    try
+    {
+        Close();
+    }
+    catch(...) { }
 }
 
-void WaveFileWriter::AppendAudioData(uint16_t* buffer, std::size_t bufferSize)
+void WaveFileWriter::AppendAudioData(const uint16_t* buffer, std::size_t bufferSize)
 {
     // Note that the audio output to the DAC of the synthesizer uses unsigned 16 bit sample values 
     // that range from 0 to 65536 but the wave file format uses signed values that range from 
     // -32768 to 32767.
     const int32_t conversionFactorFromUnsignedToSign(32768);
 
-    if(bufferSize == 0)
+    for(std::size_t i = 0; i < bufferSize; ++i)
     {
-        return;
+        int32_t convertedSampleValue = buffer[i] - conversionFactorFromUnsignedToSign;
+        if(format_ == FLOAT_32_BIT)
+        {
+            AppendSample(static_cast<float>(convertedSampleValue) / 32768.0f);
+        }
+        else
+        {
+            // Scaled up to the top of 24 bits, so it decodes to exactly the same value
+            AppendSample((format_ == PCM_24_BIT) ? convertedSampleValue * 256 : convertedSampleValue);
+        }
     }
 
+    sampleCount_ += bufferSize;
+}
+
+void WaveFileWriter::AppendAudioData(const float* buffer, std::size_t bufferSize)
+{
+    const double fullScale{(format_ == PCM_24_BIT) ? 8388608.0 : 32768.0};
+
     for(std::size_t i = 0; i < bufferSize; ++i)
     {
-        int16_t convertedSampleValue = (buffer[i] - conversionFactorFromUnsignedToSign);
-         fileStream_.write(reinterpret_cast<const char*>(&convertedSampleValue), sizeof(int16_t));
-        if(!fileStream_.good())
+        if(format_ == FLOAT_32_BIT)
         {
-            throw Exception("Failed to write the wave file");
+            AppendSample(buffer[i]);
+            continue;
         }
+
+        double value{std::floor(static_cast<double>(buffer[i]) * fullScale + 0.5)};
+        if(value > fullScale - 1.0) { value = fullScale - 1.0; }
+        else if(value < -fullScale) { value = -fullScale; }
+        AppendSample(static_cast<int32_t>(value));
     }
 
     sampleCount_ += bufferSize;
 }
 
+void WaveFileWriter::Close()
+{
+    if(closed_)
+    {
+        return;
+    }
+
+    closed_ = true;
+    Flush();
+    PatchWaveHeader();
+    fileStream_.close();
+}
+
+std::size_t WaveFileWriter::GetSampleCount()
+{
+    return sampleCount_;
+}
+
+inline void WaveFileWriter::AppendSample(int32_t sample)
+{
+    if(writeBufferUsed_ + bytesPerSample_ > writeBuffer_.size())
+    {
+        Flush();
+    }
+
+    uint32_t bits{static_cast<uint32_t>(sample)};
+    for(std::size_t i{0}; i < bytesPerSample_; ++i)
+    {
+        writeBuffer_[writeBufferUsed_++] = static_cast<char>((bits >> (8 * i)) & 0xFF);
+    }
+}
+
+inline void WaveFileWriter::AppendSample(float sample)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &sample, sizeof(bits));
+    AppendSample(static_cast<int32_t>(bits));
+}
+
+void WaveFileWriter::Flush()
+{
+    if(writeBufferUsed_ == 0)
+    {
+        return;
+    }
+
+    fileStream_.write(writeBuffer_.data(), writeBufferUsed_);
+    if(!fileStream_.good())
+    {
+        throw Exception("Failed to write the wave file");
+    }
+
+    writeBufferUsed_ = 0;
+}
+
 /*
 The following info comes from http://soundfile.sapp.org/doc/WaveFormat/
 The canonical WAVE format starts with the RIFF header:
@@ -99,80 +190,84 @@ The "data" subchunk contains the size of the data and the actual sound:
                                of the read of the subchunk following this 
                                number.
 44        *   Data             The actual sound data.
+
+Float files (audio format 3) have an 18 byte fmt chunk, the last two bytes being the (zero) size
+of an extension, and a "fact" chunk holding the number of samples between the fmt and data chunks.
+24 bit PCM is the same as 16 bit apart from the sizes.
 */
 void WaveFileWriter::WriteWaveHeader()
 {
-    WaveHeader waveHeader;
-
-    waveHeader.chunkID_[0] = 'R';
-    waveHeader.chunkID_[1] = 'I';
-    waveHeader.chunkID_[2] = 'F';
-    waveHeader.chunkID_[3] = 'F';
-
-    uint32_t subChunk2Size{static_cast<uint32_t>(sampleCount_) * static_cast<uint32_t>(sizeof(int16_t))};
-
-    uint32_t chunkSize{4 + (8 + SIZE_OF_SUBCHUNK1) + (8 + subChunk2Size)};
-
-    waveHeader.chunkSize_[0] = chunkSize & 0xFF;
-    waveHeader.chunkSize_[1] = (chunkSize >> 8) & 0xFF;
-    waveHeader.chunkSize_[2] = (chunkSize >> 16) & 0xFF;
-    waveHeader.chunkSize_[3] = (chunkSize >> 24) & 0xFF;
-
-    waveHeader.format_[0] = 'W';
-    waveHeader.format_[1] = 'A';
-    waveHeader.format_[2] = 'V';
-    waveHeader.format_[3] = 'E';
-
-    waveHeader.subChunk1ID_[0] = 'f';
-    waveHeader.subChunk1ID_[1] = 'm';
-    waveHeader.subChunk1ID_[2] = 't';
-    waveHeader.subChunk1ID_[3] = ' ';
-
-    waveHeader.subChunk1Size_[0] = SIZE_OF_SUBCHUNK1 & 0xFF;
-    waveHeader.subChunk1Size_[1] = (SIZE_OF_SUBCHUNK1 >> 8) & 0xFF;
-    waveHeader.subChunk1Size_[2] = (SIZE_OF_SUBCHUNK1 >> 16) & 0xFF;
-    waveHeader.subChunk1Size_[3] = (SIZE_OF_SUBCHUNK1 >> 24) & 0xFF;
-
-    waveHeader.audioFormat_[0] = PCM_AUDIO_FORMAT & 0xFF;
-    waveHeader.audioFormat_[1] = (PCM_AUDIO_FORMAT >> 8) & 0xFF;
-
-    waveHeader.channels_[0] = CHANNELS & 0xFF;
-    waveHeader.channels_[1] = 0;
-
-    waveHeader.sampleRate_[0] = sampleRate_ & 0xFF;
-    waveHeader.sampleRate_[1] = (sampleRate_ >> 8) & 0xFF;
-    waveHeader.sampleRate_[2] = (sampleRate_ >> 16) & 0xFF;
-    waveHeader.sampleRate_[3] = (sampleRate_ >> 24) & 0xFF;
-
-    uint32_t byteRate{static_cast<uint32_t>(sampleRate_) * static_cast<uint32_t>(sizeof(int16_t))};
+    const bool floatingPoint{format_ == FLOAT_32_BIT};
+    const uint32_t formatChunkSize{floatingPoint ? 18u : 16u};
+    const uint32_t blockAlign{static_cast<uint32_t>(CHANNELS * bytesPerSample_)};
+
+    std::vector<char> header;
+    header.insert(header.end(), {'R', 'I', 'F', 'F'});
+    WriteLittleEndian(header, 0, 4);
+    header.insert(header.end(), {'W', 'A', 'V', 'E'});
+
+    header.insert(header.end(), {'f', 'm', 't', ' '});
+    WriteLittleEndian(header, formatChunkSize, 4);
+    WriteLittleEndian(header, floatingPoint ? FLOAT_AUDIO_FORMAT : PCM_AUDIO_FORMAT, 2);
+    WriteLittleEndian(header, CHANNELS, 2);
+    WriteLittleEndian(header, static_cast<uint32_t>(sampleRate_), 4);
+    WriteLittleEndian(header, static_cast<uint32_t>(sampleRate_) * blockAlign, 4);
+    WriteLittleEndian(header, blockAlign, 2);
+    WriteLittleEndian(header, static_cast<uint32_t>(bytesPerSample_ * 8), 2);
+
+    if(floatingPoint)
+    {
+        WriteLittleEndian(header, 0, 2);
+        header.insert(header.end(), {'f', 'a', 'c', 't'});
+        WriteLittleEndian(header, 4, 4);
+        factSampleCountPosition_ = header.size();
+        WriteLittleEndian(header, 0, 4);
+    }
 
-    waveHeader.byteRate_[0] = byteRate & 0xFF;
-    waveHeader.byteRate_[1] = (byteRate >> 8) & 0xFF;
-    waveHeader.byteRate_[2] = (byteRate >> 16) & 0xFF;
-    waveHeader.byteRate_[3] = (byteRate >> 24) & 0xFF;
+    header.insert(header.end(), {'d', 'a', 't', 'a'});
+    dataSizePosition_ = header.size();
+    WriteLittleEndian(header, 0, 4);
 
-    uint32_t blockAlign{static_cast<uint32_t>(sizeof(int16_t))};
+    fileStream_.write(header.data(), header.size());
+    if(!fileStream_.good())
+    {
+        throw Exception("Failed to write wave file header");
+    }
+}
 
-    waveHeader.blockAlign_[0] = blockAlign & 0xFF;
-    waveHeader.blockAlign_[1] = (blockAlign >> 8) & 0xFF;
+void WaveFileWriter::PatchWaveHeader()
+{
+    const uint64_t dataSize{static_cast<uint64_t>(sampleCount_) * bytesPerSample_};
+    const uint64_t riffSize{(dataSizePosition_ + 4 - 8) + dataSize + (dataSize % 2)};
+    if(riffSize > std::numeric_limits<uint32_t>::max())
+    {
+        throw Exception("Too much audio for a wave file");
+    }
 
-    uint16_t bitsPerSample = sizeof(int16_t) * 8;
+    // The data chunk is padded to an even size
+    if(dataSize % 2)
+    {
+        fileStream_.put(0);
+    }
 
-    waveHeader.bitsPerSample_[0] = bitsPerSample & 0xFF;
-    waveHeader.bitsPerSample_[1] = (bitsPerSample >> 8) & 0xFF;
+    std::vector<char> riffSizeBytes;
+    WriteLittleEndian(riffSizeBytes, static_cast<uint32_t>(riffSize), 4);
+    fileStream_.seekp(4);
+    fileStream_.write(riffSizeBytes.data(), riffSizeBytes.size());
 
-    waveHeader.subChunk2ID_[0] = 'd';
-    waveHeader.subChunk2ID_[1] = 'a';
-    waveHeader.subChunk2ID_[2] = 't';
-    waveHeader.subChunk2ID_[3] = 'a';
+    std::vector<char> dataSizeBytes;
+    WriteLittleEndian(dataSizeBytes, static_cast<uint32_t>(dataSize), 4);
+    fileStream_.seekp(dataSizePosition_);
+    fileStream_.write(dataSizeBytes.data(), dataSizeBytes.size());
 
-    waveHeader.subChunk2Size_[0] = subChunk2Size & 0xFF;
-    waveHeader.subChunk2Size_[1] = (subChunk2Size >> 8) & 0xFF;
-    waveHeader.subChunk2Size_[2] = (subChunk2Size >> 16) & 0xFF;
-    waveHeader.subChunk2Size_[3] = (subChunk2Size >> 24) & 0xFF;
+    if(factSampleCountPosition_)
+    {
+        std::vector<char> sampleCountBytes;
+        WriteLittleEndian(sampleCountBytes, static_cast<uint32_t>(sampleCount_), 4);
+        fileStream_.seekp(factSampleCountPosition_);
+        fileStream_.write(sampleCountBytes.data(), sampleCountBytes.size());
+    }
 
-    fileStream_.seekp(0);
-     fileStream_.write(reinterpret_cast<const char*>(&waveHeader), sizeof(WaveHeader));
     if(!fileStream_.good())
     {
         throw Exception("Failed to write wave file header");
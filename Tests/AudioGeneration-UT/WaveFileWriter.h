@@ -2,45 +2,63 @@
 
 #include <string>
 #include <fstream>
+#include <vector>
 #include <stdint.h>
 
 
-struct WaveHeader
-{
-    uint8_t chunkID_[4];
-    uint8_t chunkSize_[4];
-    uint8_t format_[4];
-    uint8_t subChunk1ID_[4];
-    uint8_t subChunk1Size_[4];
-    uint8_t audioFormat_[2];
-    uint8_t channels_[2];
-    uint8_t sampleRate_[4];
-    uint8_t byteRate_[4];
-    uint8_t blockAlign_[2];
-    uint8_t bitsPerSample_[2];
-    uint8_t subChunk2ID_[4];
-    uint8_t subChunk2Size_[4];
-};
-
-
+// Streams mono audio out to a wave file.  Any number of blocks can be appended one after another;
+// they're gathered in a large write buffer and go to disk a buffer at a time.  The sizes in the
+// RIFF header aren't known until the end, so they're patched in when the file is closed (which the
+// destructor does if Close hasn't been called).
 class WaveFileWriter
 {
     public:
-        WaveFileWriter(const std::string& filename, std::size_t sampleRate);
+        enum Format
+        {
+            PCM_16_BIT,
+            PCM_24_BIT,
+            FLOAT_32_BIT
+        };
+
+        WaveFileWriter(const std::string& filename, std::size_t sampleRate, Format format = PCM_16_BIT);
         ~WaveFileWriter();
 
-        void AppendAudioData(uint16_t* buffer, std::size_t bufferSize);
+        // The synthesizer's unsigned 16 bit DAC samples
+        void AppendAudioData(const uint16_t* buffer, std::size_t bufferSize);
+
+        // Samples from -1.0 to 1.0.  Anything beyond that is clipped unless the file's float.
+        void AppendAudioData(const float* buffer, std::size_t bufferSize);
+
+        // Writes out whatever's buffered and finishes the header.  Unlike the destructor, this
+        // throws if that fails.
+        void Close();
+
+        std::size_t GetSampleCount();
 
     private:
         void WriteWaveHeader();
+        void PatchWaveHeader();
+        void AppendSample(int32_t sample);
+        void AppendSample(float sample);
+        void Flush();
 
         std::string filename_;
         std::size_t sampleRate_;
+        Format format_;
+        std::size_t bytesPerSample_;
         std::size_t sampleCount_;
         std::ofstream fileStream_;
+        bool closed_;
+
+        std::vector<char> writeBuffer_;
+        std::size_t writeBufferUsed_;
+
+        // Where the sizes that are patched in on close are in the header
+        std::size_t dataSizePosition_;
+        std::size_t factSampleCountPosition_;
 
-        static const uint32_t SIZE_OF_SUBCHUNK1{16};
+        static const std::size_t WRITE_BUFFER_SIZE{1 << 20};
         static const uint16_t PCM_AUDIO_FORMAT{1};
-        static const uint8_t CHANNELS{1};
-        //static const std::size_t WAVE_HEADER_SIZE{44};
+        static const uint16_t FLOAT_AUDIO_FORMAT{3};
+        static const uint16_t CHANNELS{1};
 };
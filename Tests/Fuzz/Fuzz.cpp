@@ -0,0 +1,205 @@
+#include <Fuzz/MIDIParserFuzz.h>
+#include <Fuzz/MenuSystemFuzz.h>
+#include <MIDI/MIDIParser.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+// Runs the fuzz harnesses on random streams, for when libFuzzer isn't to hand (see the
+// FUZZ_WITH_LIBFUZZER option for when it is).  Every run is seeded, and a broken invariant prints
+// the seed and iteration so the failing stream can be made again.
+//
+//     Fuzz [midi|menu|all] [--iterations count] [--seed number]
+//
+// Along the way it measures how fast the MIDI parser gets through a long stream.
+
+// The bytes in a stream that means something is far more likely to find a problem than noise
+// would, so the MIDI streams are mostly made of messages, with stray bytes mixed in
+std::vector<uint8_t> MakeMIDIStream(std::mt19937& random, std::size_t size)
+{
+    std::uniform_int_distribution<int> anyByte{0, 255};
+    std::uniform_int_distribution<int> dataByte{0, 127};
+    std::uniform_int_distribution<int> channel{0, 15};
+    std::uniform_int_distribution<int> choice{0, 99};
+    std::vector<uint8_t> stream;
+
+    while(stream.size() < size)
+    {
+        int kind{choice(random)};
+        if(kind < 30)
+        {
+            // A note on or off, with or without its status byte (i.e. under running status)
+            if(choice(random) < 70)
+            {
+                stream.push_back(static_cast<uint8_t>(((choice(random) < 60) ? 0x90 : 0x80) | channel(random)));
+            }
+            stream.push_back(static_cast<uint8_t>(dataByte(random)));
+            stream.push_back(static_cast<uint8_t>((choice(random) < 25) ? 0 : dataByte(random)));
+        }
+        else if(kind < 40)
+        {
+            // A controller, often one that turns every note off
+            int controller{(choice(random) < 50) ? ((choice(random) < 50) ? 123 : 120) : dataByte(random)};
+            stream.push_back(static_cast<uint8_t>(0xB0 | channel(random)));
+            stream.push_back(static_cast<uint8_t>(controller));
+            stream.push_back(static_cast<uint8_t>(dataByte(random)));
+        }
+        else if(kind < 50)
+        {
+            // Some other channel message (aftertouch, program change, pressure or pitch bend)
+            const uint8_t statuses[]{0xA0, 0xC0, 0xD0, 0xE0};
+            uint8_t status{statuses[choice(random) % 4]};
+            stream.push_back(static_cast<uint8_t>(status | channel(random)));
+            stream.push_back(static_cast<uint8_t>(dataByte(random)));
+            if(status == 0xA0 || status == 0xE0)
+            {
+                stream.push_back(static_cast<uint8_t>(dataByte(random)));
+            }
+        }
+        else if(kind < 55)
+        {
+            // A SysEx message, now and then too long for the parser's buffer or cut short
+            std::size_t length{static_cast<std::size_t>(choice(random)) * ((choice(random) < 10) ? 3 : 1)};
+            stream.push_back(0xF0);
+            for(std::size_t i{0}; i < length; ++i)
+            {
+                stream.push_back(static_cast<uint8_t>(dataByte(random)));
+            }
+            if(choice(random) < 90)
+            {
+                stream.push_back(0xF7);
+            }
+        }
+        else if(kind < 65)
+        {
+            // Real time bytes turn up anywhere, including in the middle of the messages above
+            stream.push_back(static_cast<uint8_t>(0xF8 + choice(random) % 8));
+        }
+        else if(kind < 68)
+        {
+            // Marks where the harness sends an All Notes Off and checks nothing's held
+            stream.push_back((choice(random) < 50) ? 0xF4 : 0xF5);
+        }
+        else
+        {
+            stream.push_back(static_cast<uint8_t>(anyByte(random)));
+        }
+    }
+
+    stream.resize(size);
+    return stream;
+}
+
+std::vector<uint8_t> MakeMenuStream(std::mt19937& random, std::size_t size)
+{
+    std::uniform_int_distribution<int> anyByte{0, 255};
+    std::vector<uint8_t> stream(size);
+    for(uint8_t& action : stream)
+    {
+        action = static_cast<uint8_t>(anyByte(random));
+    }
+
+    return stream;
+}
+
+void PrintUsage()
+{
+    std::printf("Usage: Fuzz [midi|menu|all] [--iterations count] [--seed number]\n");
+}
+
+// Parses a long stream with nothing checked, for the parser's throughput.  The firmware has to keep
+// up with a MIDI cable, which carries at most 3125 bytes a second (31250 baud, 10 bits a byte).
+void MeasureMIDIParser(std::mt19937& random)
+{
+    const std::size_t streamSize{16 * 1024 * 1024};
+    std::vector<uint8_t> stream{MakeMIDIStream(random, streamSize)};
+    MIDIParser midiParser;
+
+    auto startTime{std::chrono::steady_clock::now()};
+    for(uint8_t midiByte : stream)
+    {
+        midiParser.HandleByte(midiByte);
+    }
+    std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - startTime};
+
+    // Keeps the parsing from being optimized away
+    volatile uint8_t mostRecentKey{midiParser.GetMostRecentKey()};
+    (void)mostRecentKey;
+
+    double bytesPerSecond{static_cast<double>(streamSize) / elapsed.count()};
+    std::printf("MIDI parser: %.1f MB/s, %.2f ns/byte, %.0fx a MIDI cable's 3125 bytes/s\n",
+        bytesPerSecond / 1.0e6, 1.0e9 / bytesPerSecond, bytesPerSecond / 3125.0);
+
+#if defined(__SANITIZE_ADDRESS__)
+    std::printf("(Built with sanitizers, so the parser's far slower here than it would be otherwise)\n");
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    std::string harness{"all"};
+    std::size_t iterationCount{2000};
+    uint32_t seed{std::random_device{}()};
+
+    for(int i{1}; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc)
+        {
+            iterationCount = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if(std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if(std::strcmp(argv[i], "midi") == 0 || std::strcmp(argv[i], "menu") == 0 || std::strcmp(argv[i], "all") == 0)
+        {
+            harness = argv[i];
+        }
+        else
+        {
+            PrintUsage();
+            return (std::strcmp(argv[i], "--help") == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    // Printed up front, as a broken invariant aborts
+    std::printf("Seed %u\n", static_cast<unsigned>(seed));
+    std::fflush(stdout);
+    std::mt19937 random{seed};
+    std::uniform_int_distribution<std::size_t> streamSize{1, 4096};
+
+    if(harness == "midi" || harness == "all")
+    {
+        std::size_t byteCount{0};
+        for(std::size_t iteration{0}; iteration < iterationCount; ++iteration)
+        {
+            std::vector<uint8_t> stream{MakeMIDIStream(random, streamSize(random))};
+            std::fprintf(stderr, "\rMIDI parser iteration %zu", iteration);
+            FuzzMIDIParser(stream.data(), stream.size());
+            byteCount += stream.size();
+        }
+        std::fprintf(stderr, "\r");
+        std::printf("MIDI parser: %zu streams, %zu bytes, no invariant broken\n", iterationCount, byteCount);
+        MeasureMIDIParser(random);
+    }
+
+    if(harness == "menu" || harness == "all")
+    {
+        std::size_t actionCount{0};
+        for(std::size_t iteration{0}; iteration < iterationCount; ++iteration)
+        {
+            std::vector<uint8_t> stream{MakeMenuStream(random, streamSize(random))};
+            std::fprintf(stderr, "\rMenu system iteration %zu", iteration);
+            FuzzMenuSystem(stream.data(), stream.size());
+            actionCount += stream.size();
+        }
+        std::fprintf(stderr, "\r");
+        std::printf("Menu system: %zu streams, %zu actions, no invariant broken\n", iterationCount, actionCount);
+    }
+
+    return EXIT_SUCCESS;
+}
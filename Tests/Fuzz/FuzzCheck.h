@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+// Fuzzing stops at the first broken invariant, the same way libFuzzer stops at a crash, so the
+// input that broke it is the one to reproduce it with
+inline void FuzzCheck(bool condition, const char* invariant)
+{
+    if(!condition)
+    {
+        std::fprintf(stderr, "Invariant broken: %s\n", invariant);
+        std::abort();
+    }
+}
@@ -0,0 +1,13 @@
+#include <Fuzz/MIDIParserFuzz.h>
+#include <Fuzz/MenuSystemFuzz.h>
+
+// The entry point for libFuzzer, which is built once per harness (see FUZZ_WITH_LIBFUZZER)
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size)
+{
+#if defined(FUZZ_MIDI_PARSER)
+    FuzzMIDIParser(data, size);
+#elif defined(FUZZ_MENU_SYSTEM)
+    FuzzMenuSystem(data, size);
+#endif
+    return 0;
+}
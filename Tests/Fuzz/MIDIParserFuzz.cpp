@@ -0,0 +1,67 @@
+#include <Fuzz/MIDIParserFuzz.h>
+#include <Fuzz/FuzzCheck.h>
+#include <MIDI/MIDIParser.h>
+#include <memory>
+
+void CheckHeldKeys(MIDIParser& midiParser)
+{
+    uint8_t mostRecentKey{midiParser.GetMostRecentKey()};
+    FuzzCheck(mostRecentKey < MIDIParser::NOTE_COUNT, "the most recent key is a MIDI note");
+
+    bool anyHeld{false};
+    for(uint8_t note{0}; note < MIDIParser::NOTE_COUNT; ++note)
+    {
+        anyHeld = anyHeld || midiParser.GetNoteHeld(note);
+    }
+    FuzzCheck(!anyHeld || midiParser.GetNoteHeld(mostRecentKey), "the most recent key is held, if any is");
+}
+
+void CheckSysExMessage(MIDIParser& midiParser)
+{
+    uint8_t message[MIDIParser::MAX_SYSEX_SIZE];
+    uint32_t messageSize{midiParser.GetSysExMessage(message, sizeof(message))};
+    if(messageSize == 0)
+    {
+        return;
+    }
+
+    FuzzCheck(messageSize >= 2 && messageSize <= MIDIParser::MAX_SYSEX_SIZE, "a SysEx message fits the buffer");
+    FuzzCheck(message[0] == 0xF0 && message[messageSize - 1] == 0xF7, "a SysEx message runs from 0xF0 to 0xF7");
+    for(uint32_t i{1}; i + 1 < messageSize; ++i)
+    {
+        FuzzCheck(message[i] < 0x80, "a SysEx message only carries data bytes");
+    }
+}
+
+void FuzzMIDIParser(const uint8_t* data, std::size_t size)
+{
+    // On the heap, so a write past its note table is caught rather than landing on the stack
+    std::unique_ptr<MIDIParser> midiParser{new MIDIParser};
+    uint32_t callCount{midiParser->GetCallCount()};
+
+    for(std::size_t i{0}; i < size; ++i)
+    {
+        midiParser->HandleByte(data[i]);
+
+        if(data[i] == 0xF4 || data[i] == 0xF5)
+        {
+            midiParser->HandleByte(0xB0 | (data[i] & 0x0F));
+            midiParser->HandleByte(123);
+            midiParser->HandleByte(0);
+            FuzzCheck(midiParser->GetMostRecentKey() == 0, "no key plays after All Notes Off");
+            for(uint8_t note{0}; note < MIDIParser::NOTE_COUNT; ++note)
+            {
+                FuzzCheck(!midiParser->GetNoteHeld(note), "no key is held after All Notes Off");
+            }
+        }
+
+        CheckHeldKeys(*midiParser);
+        FuzzCheck(midiParser->GetCallCount() >= callCount, "the call count only goes up");
+        callCount = midiParser->GetCallCount();
+
+        if(data[i] == 0xF7)
+        {
+            CheckSysExMessage(*midiParser);
+        }
+    }
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Feeds the bytes to a new MIDIParser as if they'd arrived at the MIDI input, checking its state
+// after every one.  The undefined system common bytes 0xF4 and 0xF5 are passed on as they are, but
+// each is also followed by an All Notes Off, after which no key may be held.
+void FuzzMIDIParser(const uint8_t* data, std::size_t size);
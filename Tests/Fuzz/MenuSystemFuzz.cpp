@@ -0,0 +1,71 @@
+#include <Fuzz/MenuSystemFuzz.h>
+#include <Fuzz/FuzzCheck.h>
+#include <SynthMenu/SynthMenu.h>
+#include <AudioGeneration/AudioMixer.h>
+#include <AudioGeneration/AudioSettings.h>
+#include <cstring>
+#include <memory>
+
+// Keeps the display's lines, checking each one the menu system writes fits on the display
+class FuzzMenuOutput : public MenuOutput
+{
+    public:
+        void SetText(uint8_t line, const char* text)
+        {
+            FuzzCheck(line < MenuSystem::MENU_ROWS, "the menu only writes to the display's lines");
+            FuzzCheck(text != nullptr, "the menu writes text to the display");
+            FuzzCheck(std::strlen(text) <= MenuSystem::TEXT_SIZE, "a line of the menu fits on the display");
+            std::strcpy(lines_[line], text);
+        }
+
+        const char* GetLine(uint8_t line) { return lines_[line]; }
+
+    private:
+        char lines_[MenuSystem::MENU_ROWS][MenuSystem::TEXT_SIZE + MenuSystem::NULL_CHAR_SIZE];
+};
+
+void CheckMenuSystem(MenuSystem& menuSystem, FuzzMenuOutput& output)
+{
+    Menu* currentMenu{menuSystem.GetCurrentMenu()};
+    FuzzCheck(currentMenu != nullptr, "there's always a current menu");
+
+    uint8_t rowCount{currentMenu->GetRowCount()};
+    uint8_t currentRow{menuSystem.GetCurrentRow()};
+    uint8_t topRow{menuSystem.GetTopRow()};
+    FuzzCheck(rowCount > 0 && rowCount <= Menu::MAX_ITEMS, "every menu has items, and no more than fit");
+    FuzzCheck(currentRow < rowCount, "the current row is one of the menu's");
+    FuzzCheck(topRow <= currentRow && currentRow < topRow + MenuSystem::MENU_ROWS, "the current row is on the display");
+
+    MenuItem currentItem{currentMenu->GetItem(currentRow)};
+    FuzzCheck(!menuSystem.GetValueTweaking() || currentItem.GetMenuItemValue() != nullptr, "only a value is tweaked");
+
+    for(uint8_t line{0}; line < MenuSystem::MENU_ROWS; ++line)
+    {
+        bool marked{std::strncmp(output.GetLine(line), "> ", 2) == 0};
+        FuzzCheck(marked == (topRow + line == currentRow), "the current row, and only it, is marked on the display");
+    }
+}
+
+void FuzzMenuSystem(const uint8_t* data, std::size_t size)
+{
+    // The mixer's too big to be comfortable on the stack
+    std::unique_ptr<AudioMixer> audioMixer{new AudioMixer};
+    FuzzMenuOutput output;
+    SynthMenu synthMenu(&output, *audioMixer);
+    MenuSystem& menuSystem{synthMenu.GetMenuSystem()};
+    CheckMenuSystem(menuSystem, output);
+
+    const MenuSystem::Action actions[]{MenuSystem::UP, MenuSystem::DOWN, MenuSystem::BACK, MenuSystem::ENTER};
+    uint16_t audioData[CONTROL_BLOCK_SIZE];
+    for(std::size_t i{0}; i < size; ++i)
+    {
+        synthMenu.HandleAction(actions[data[i] & 0x03]);
+        CheckMenuSystem(menuSystem, output);
+
+        if(data[i] & 0x80)
+        {
+            audioMixer->SetMIDINote((data[i] & 0x04) ? 60 : 0);
+            audioMixer->GetAudioData(audioData, CONTROL_BLOCK_SIZE);
+        }
+    }
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Drives the synth's menu with one action per byte (the low two bits pick UP, DOWN, BACK or
+// ENTER) and checks where the menu system's at and what it shows after every one.  When a byte's
+// top bit is set, a control block of audio is rendered after its action, so the settings the menu
+// changed are put to use.
+void FuzzMenuSystem(const uint8_t* data, std::size_t size);
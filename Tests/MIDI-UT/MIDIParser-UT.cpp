@@ -0,0 +1,122 @@
+#include "catch.hpp"
+#include <MIDI/MIDIParser.h>
+#include <vector>
+
+void Send(MIDIParser& midiParser, const std::vector<uint8_t>& midiBytes)
+{
+    for(uint8_t midiByte : midiBytes)
+    {
+        midiParser.HandleByte(midiByte);
+    }
+}
+
+TEST_CASE("MIDI Parser")
+{
+    MIDIParser midiParser;
+
+    SECTION("Nothing Held To Start With")
+    {
+        REQUIRE(midiParser.GetMostRecentKey() == 0);
+        REQUIRE(midiParser.GetCallCount() == 0);
+    }
+
+    SECTION("Note On And Off")
+    {
+        Send(midiParser, {0x90, 60, 100});
+        REQUIRE(midiParser.GetMostRecentKey() == 60);
+        REQUIRE(midiParser.GetNoteHeld(60));
+
+        Send(midiParser, {0x80, 60, 64});
+        REQUIRE(midiParser.GetMostRecentKey() == 0);
+        REQUIRE_FALSE(midiParser.GetNoteHeld(60));
+        REQUIRE(midiParser.GetCallCount() == 2);
+    }
+
+    SECTION("A Note On With No Velocity Is A Note Off")
+    {
+        Send(midiParser, {0x93, 48, 100, 0x93, 48, 0});
+        REQUIRE(midiParser.GetMostRecentKey() == 0);
+    }
+
+    SECTION("The Most Recently Pressed Key Still Held Plays")
+    {
+        Send(midiParser, {0x90, 48, 100, 0x90, 52, 100, 0x90, 55, 100});
+        REQUIRE(midiParser.GetMostRecentKey() == 55);
+
+        Send(midiParser, {0x80, 55, 0});
+        REQUIRE(midiParser.GetMostRecentKey() == 52);
+
+        Send(midiParser, {0x80, 48, 0});
+        REQUIRE(midiParser.GetMostRecentKey() == 52);
+    }
+
+    SECTION("Running Status")
+    {
+        // Keyboards often send a status byte once, then only the notes and velocities after it
+        Send(midiParser, {0x90, 48, 100, 52, 100, 55, 100});
+        REQUIRE(midiParser.GetMostRecentKey() == 55);
+
+        Send(midiParser, {55, 0, 52, 0});
+        REQUIRE(midiParser.GetMostRecentKey() == 48);
+    }
+
+    SECTION("All Notes Off And All Sound Off Release Every Key")
+    {
+        Send(midiParser, {0x90, 48, 100, 52, 100, 55, 100});
+        Send(midiParser, {0xB5, 123, 0});
+        REQUIRE(midiParser.GetMostRecentKey() == 0);
+        REQUIRE_FALSE(midiParser.GetNoteHeld(48));
+
+        Send(midiParser, {0x90, 60, 100, 0xB0, 120, 0});
+        REQUIRE(midiParser.GetMostRecentKey() == 0);
+
+        // Other controllers leave the keys alone
+        Send(midiParser, {0x90, 60, 100, 0xB0, 1, 127});
+        REQUIRE(midiParser.GetMostRecentKey() == 60);
+    }
+
+    SECTION("Other Channel Messages Are Skipped Over")
+    {
+        // Pitch bend and program change data bytes mustn't be taken for notes
+        Send(midiParser, {0x90, 60, 100, 0xE0, 0, 64, 0xC0, 5, 0x90, 62, 100});
+        REQUIRE(midiParser.GetMostRecentKey() == 62);
+        REQUIRE(midiParser.GetCallCount() == 2);
+    }
+
+    SECTION("A Status Byte Interrupting A Note Abandons It")
+    {
+        // These used to be taken as the note number, past the end of the note table
+        Send(midiParser, {0x90, 0xF8, 60, 100});
+        REQUIRE(midiParser.GetMostRecentKey() == 60);
+
+        Send(midiParser, {0x90, 0xC0, 100, 0x90, 62, 0xE0, 0x80});
+        REQUIRE(midiParser.GetMostRecentKey() == 60);
+        REQUIRE_FALSE(midiParser.GetNoteHeld(62));
+        REQUIRE(midiParser.GetCallCount() == 1);
+    }
+
+    SECTION("A SysEx Message Is Kept Until It's Picked Up")
+    {
+        uint8_t message[MIDIParser::MAX_SYSEX_SIZE];
+        Send(midiParser, {0xF0, 0x7E, 0x7F, 0xF8, 0x09, 0x01, 0xF7});
+        REQUIRE(midiParser.GetSysExMessage(message, sizeof(message)) == 6);
+        REQUIRE(message[0] == 0xF0);
+        REQUIRE(message[4] == 0x01);
+        REQUIRE(message[5] == 0xF7);
+        REQUIRE(midiParser.GetSysExMessage(message, sizeof(message)) == 0);
+
+        // One too long for the buffer is dropped
+        midiParser.HandleByte(0xF0);
+        for(uint32_t i = 0; i < MIDIParser::MAX_SYSEX_SIZE; ++i)
+        {
+            midiParser.HandleByte(0x01);
+        }
+        midiParser.HandleByte(0xF7);
+        REQUIRE(midiParser.GetSysExMessage(message, sizeof(message)) == 0);
+
+        // And a status byte cuts one short, and is then handled as usual
+        Send(midiParser, {0xF0, 0x7E, 0x90, 60, 100, 0xF7});
+        REQUIRE(midiParser.GetSysExMessage(message, sizeof(message)) == 0);
+        REQUIRE(midiParser.GetMostRecentKey() == 60);
+    }
+}
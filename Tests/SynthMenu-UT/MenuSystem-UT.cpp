@@ -1,6 +1,6 @@
 #include "catch.hpp"
 #include <SynthMenu/SynthMenu.h>
-#include <AudioGeneration/Oscillator.h>
+#include <AudioGeneration/AudioMixer.h>
 #include <Utilities/StringUtilities.h>
 #include <SynthMenu-UT/SynthMenuOutput.h>
 #include <string.h>
@@ -19,18 +19,16 @@ TEST_CASE("Menu System")
 {
     SynthMenuOutput testOutput;
 
-    Oscillator oscillator1(Square, 10, 0, 0);
-    Oscillator oscillator2(Square, 10, 8, 0);
-    Oscillator oscillator3(Square, 10, -8, 0);
+    AudioMixer audioMixer;
     
-    SynthMenu synthMenu(&testOutput, oscillator1, oscillator2, oscillator3);
+    SynthMenu synthMenu(&testOutput, audioMixer);
 
     SECTION("Initial Menu")
     {
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Oscillator 1"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Oscillator 2"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Oscillator 3"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Filter"));
     }
 
     SECTION("Test Navigating Down")
@@ -40,21 +38,90 @@ TEST_CASE("Menu System")
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Oscillator 1"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Oscillator 2"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Oscillator 3"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Filter"));
 
         synthMenu.HandleAction(MenuSystem::DOWN);
 
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Oscillator 1"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Oscillator 2"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Oscillator 3"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Filter"));
 
         synthMenu.HandleAction(MenuSystem::DOWN);
 
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Oscillator 1"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Oscillator 2"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Oscillator 3"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Oscillator 3"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Filter"));
+
+        // The main menu has more rows than the display, so it scrolls from here on
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Oscillator 2"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Oscillator 3"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Filter"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> LFO 1"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Filter"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  LFO 1"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  LFO 2"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Mod Matrix"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  LFO 2"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Mod Matrix"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Sync / FM"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Glide"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Mod Matrix"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Sync / FM"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Glide"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Effects"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Sync / FM"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Glide"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Effects"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Output"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Glide"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Effects"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Output"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Tuning"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Glide"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Effects"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Output"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Tuning"));
+
+        // Moving back up only scrolls once the top line is reached
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::UP);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Glide"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Effects"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Output"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Tuning"));
+
+        synthMenu.HandleAction(MenuSystem::UP);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Sync / FM"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Glide"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Effects"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Output"));
     }    
 
     SECTION("Test Navigating Back Up")
@@ -66,21 +133,21 @@ TEST_CASE("Menu System")
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Oscillator 1"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Oscillator 2"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Oscillator 3"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Filter"));
 
         synthMenu.HandleAction(MenuSystem::UP);
 
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Oscillator 1"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Oscillator 2"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Oscillator 3"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Filter"));
 
         synthMenu.HandleAction(MenuSystem::UP);
 
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Oscillator 1"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Oscillator 2"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Oscillator 3"));
-        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Filter"));
     }    
 
     SECTION("Test Navigating To Oscillator")
@@ -112,6 +179,27 @@ TEST_CASE("Menu System")
 
         synthMenu.HandleAction(MenuSystem::DOWN);
 
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: Noise"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Semitone: 0"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: Pink"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Semitone: 0"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: Sample"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Semitone: 0"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: None"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
@@ -133,6 +221,27 @@ TEST_CASE("Menu System")
 
         synthMenu.HandleAction(MenuSystem::UP);
 
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: Sample"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Semitone: 0"));
+
+        synthMenu.HandleAction(MenuSystem::UP);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: Pink"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Semitone: 0"));
+
+        synthMenu.HandleAction(MenuSystem::UP);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: Noise"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Semitone: 0"));
+
+        synthMenu.HandleAction(MenuSystem::UP);
+
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Waveform: Sawtooth"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Level: 10"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
@@ -301,4 +410,532 @@ TEST_CASE("Menu System")
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Cent: 0"));
         REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Semitone: -12"));
     }
+
+    SECTION("Test Changing Oscillator Pulse Width")
+    {
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 4; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Level: 10"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Semitone: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Pulse Width: 50%"));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Pulse Width: 55%"));
+        REQUIRE(audioMixer.GetOscillator1().GetPulseWidth() == 55);
+
+        for(std::size_t i{0}; i < 20; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Pulse Width: 95%"));
+
+        for(std::size_t i{0}; i < 30; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Pulse Width: 5%"));
+        REQUIRE(audioMixer.GetOscillator1().GetPulseWidth() == 5);
+        REQUIRE(audioMixer.GetOscillator2().GetPulseWidth() == 50);
+    }
+
+    SECTION("Test Changing Oscillator Anti-Alias")
+    {
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 5; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Cent: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Semitone: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Pulse Width: 50%"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Anti-Alias: Off"));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Anti-Alias: On"));
+        REQUIRE(audioMixer.GetOscillator1().GetBandLimited());
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Anti-Alias: Off"));
+        REQUIRE(!audioMixer.GetOscillator1().GetBandLimited());
+    }
+
+    SECTION("Test Changing Oscillator Unison")
+    {
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 6; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Semitone: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Pulse Width: 50%"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Anti-Alias: Off"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Unison: 1"));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Unison: 1"));
+
+        for(std::size_t i{0}; i < 20; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Unison: 16"));
+        REQUIRE(audioMixer.GetOscillator1().GetUnisonCount() == 16);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Pulse Width: 50%"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Anti-Alias: Off"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Unison: 16"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Spread: 15"));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 40; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Spread: 50"));
+
+        for(std::size_t i{0}; i < 60; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Spread: 0"));
+        REQUIRE(audioMixer.GetOscillator1().GetUnisonSpread() == 0);
+    }
+
+    SECTION("Test Changing Filter")
+    {
+        for(std::size_t i{0}; i < 3; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Type: Off"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Cutoff: 127"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Resonance: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Type: Low Pass"));
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Type: Band Pass"));
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Type: High Pass"));
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Type: Off"));
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Type: High Pass"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Cutoff: 127"));
+
+        for(std::size_t i{0}; i < 27; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Cutoff: 100"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 11; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Resonance: 10"));
+
+        REQUIRE(audioMixer.GetFilter().GetMode() == HighPass);
+        REQUIRE(audioMixer.GetFilter().GetCutoff() == 100);
+        REQUIRE(audioMixer.GetFilter().GetResonance() == 10);
+    }
+
+    SECTION("Test Changing LFO")
+    {
+        for(std::size_t i{0}; i < 4; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Shape: Triangle"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Rate: 2.0Hz"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), ""));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Shape: Square"));
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Shape: S&H"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 5; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Rate: 2.5Hz"));
+
+        for(std::size_t i{0}; i < 30; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Rate: 0.1Hz"));
+
+        REQUIRE(audioMixer.GetLFO1().GetShape() == LFO::SAMPLE_AND_HOLD);
+        REQUIRE(audioMixer.GetLFO1().GetRate() == 1);
+        REQUIRE(audioMixer.GetLFO2().GetShape() == LFO::TRIANGLE);
+    }
+
+    SECTION("Test Changing Modulation Matrix")
+    {
+        for(std::size_t i{0}; i < 6; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Slot: 1"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Source: None"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Dest: None"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Amount: 0"));
+
+        // Select slot 3
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Slot: 3"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Source: LFO 2"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Dest: Pulse Width"));
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Dest: Cutoff"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 30; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Amount: -100"));
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Amount: -95"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        // Going back to slot 1 shows slot 1's (untouched) routing
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Slot: 1"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Source: None"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Dest: None"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Amount: 0"));
+
+        ModulationMatrix& modulationMatrix{audioMixer.GetModulationMatrix()};
+        REQUIRE(modulationMatrix.GetSource(2) == ModulationMatrix::LFO_2);
+        REQUIRE(modulationMatrix.GetDestination(2) == ModulationMatrix::FILTER_CUTOFF);
+        REQUIRE(modulationMatrix.GetAmount(2) == -95);
+    }
+
+    SECTION("Test Changing Oscillator Sync And FM")
+    {
+        for(std::size_t i{0}; i < 7; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Hard Sync: Off"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  FM Amount: 0"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Oversample: Off"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Hard Sync: On"));
+        REQUIRE(audioMixer.GetHardSync());
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> FM Amount: 0"));
+
+        for(std::size_t i{0}; i < 25; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> FM Amount: 100"));
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> FM Amount: 95"));
+        REQUIRE(audioMixer.GetFMAmount() == 95);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Oversample: On"));
+        REQUIRE(audioMixer.GetOversampling());
+    }
+
+    SECTION("Test Changing Glide")
+    {
+        for(std::size_t i{0}; i < 8; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Time: 0ms"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Mode: Fixed"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Legato: On"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), ""));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 10; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Time: 200ms"));
+
+        for(std::size_t i{0}; i < 100; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Time: 2000ms"));
+        REQUIRE(audioMixer.GetGlide().GetTime() == 100);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Mode: Per Octave"));
+        REQUIRE(audioMixer.GetGlide().GetMode() == Glide::RATE);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Legato: Off"));
+        REQUIRE(!audioMixer.GetGlide().GetLegato());
+    }
+
+    SECTION("Test Changing Output Stage")
+    {
+        for(std::size_t i{0}; i < 10; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Enabled: Off"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Gain: +0dB"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Limiter: On"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Dither: Off"));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Enabled: On"));
+        REQUIRE(audioMixer.GetOutputStage().GetEnabled());
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Gain: +0dB"));
+
+        for(std::size_t i{0}; i < 6; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Gain: +6dB"));
+
+        for(std::size_t i{0}; i < 20; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Gain: +18dB"));
+        REQUIRE(audioMixer.GetOutputStage().GetGain() == 18);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Limiter: Off"));
+        REQUIRE(!audioMixer.GetOutputStage().GetLimiter());
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Dither: On"));
+        REQUIRE(audioMixer.GetOutputStage().GetDither());
+    }
+
+    SECTION("Test Changing Effects")
+    {
+        for(std::size_t i{0}; i < 9; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Chorus: Off"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Rate: 0.8Hz"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "  Depth: 50%"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "  Delay: Off"));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Chorus: Chorus"));
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Chorus: Flanger"));
+        REQUIRE(audioMixer.GetChorus().GetMode() == Chorus::FLANGER);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 10; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Rate: 0.1Hz"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 20; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(2), "> Depth: 100%"));
+        REQUIRE(audioMixer.GetChorus().GetDepth() == 100);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 5; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Delay: 50ms"));
+        REQUIRE(audioMixer.GetDelay().GetTime() == 5);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Rate: 0.1Hz"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Feedback: 40%"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 20; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Feedback: 90%"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 4; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Delay Mix: 30%"));
+        REQUIRE(audioMixer.GetDelay().GetMix() == 30);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Reverb: Off"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 5; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Reverb: 25%"));
+        REQUIRE(audioMixer.GetReverb().GetMix() == 25);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "  Feedback: 90%"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Room Size: 50%"));
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(3), "> Room Size: 45%"));
+        REQUIRE(audioMixer.GetReverb().GetSize() == 45);
+    }
+
+    SECTION("Test Changing Tuning")
+    {
+        for(std::size_t i{0}; i < 11; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Scale: Equal"));
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "  Reference: 440Hz"));
+
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Scale: Just"));
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Scale: Pythagorean"));
+        synthMenu.HandleAction(MenuSystem::UP);
+        synthMenu.HandleAction(MenuSystem::UP);
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(0), "> Scale: Meantone"));
+        REQUIRE(audioMixer.GetTuning().GetScale() == Tuning::MEANTONE);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+
+        synthMenu.HandleAction(MenuSystem::DOWN);
+        synthMenu.HandleAction(MenuSystem::ENTER);
+        for(std::size_t i{0}; i < 8; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::DOWN);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Reference: 432Hz"));
+        REQUIRE(audioMixer.GetTuning().GetReferencePitch() == 432);
+
+        for(std::size_t i{0}; i < 60; ++i)
+        {
+            synthMenu.HandleAction(MenuSystem::UP);
+        }
+        REQUIRE(RawStringsEqual(testOutput.GetTextLine(1), "> Reference: 466Hz"));
+    }
 }
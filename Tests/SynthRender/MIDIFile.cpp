@@ -0,0 +1,244 @@
+#include <SynthRender/MIDIFile.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <cstring>
+
+// Until the file says otherwise the tempo's 120 beats per minute
+const uint32_t defaultMicrosecondsPerQuarter{500000};
+
+const uint8_t metaEvent{0xFF};
+const uint8_t tempoMetaType{0x51};
+const uint8_t allNotesOffController{123};
+
+namespace
+{
+
+// Standard MIDI Files are big endian
+uint32_t ReadBigEndian(const uint8_t* bytes, std::size_t byteCount)
+{
+    uint32_t value{0};
+    for(std::size_t i{0}; i < byteCount; ++i)
+    {
+        value = (value << 8) | bytes[i];
+    }
+
+    return value;
+}
+
+}
+
+MIDIFile::MIDIFile(const std::string& filename) : filename_{filename}, division_{0}, length_{0.0}
+{
+    std::ifstream fileStream(filename_, std::ios::in | std::ios::binary);
+    if(!fileStream.is_open())
+    {
+        throw Exception("Failed to open MIDI file " + filename_);
+    }
+
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
+    if(file.size() < 14 || std::memcmp(file.data(), "MThd", 4) != 0)
+    {
+        throw Exception(filename_ + " isn't a MIDI file");
+    }
+
+    std::size_t headerSize{ReadBigEndian(&(file[4]), 4)};
+    uint16_t format{static_cast<uint16_t>(ReadBigEndian(&(file[8]), 2))};
+    division_ = static_cast<uint16_t>(ReadBigEndian(&(file[12]), 2));
+    if(format > 1 || headerSize < 6 || division_ == 0)
+    {
+        throw Exception(filename_ + " is a format 2 MIDI file or has a bad header");
+    }
+
+    std::vector<TrackEvent> trackEvents;
+    std::size_t position{8 + headerSize};
+    while(position + 8 <= file.size())
+    {
+        std::size_t chunkSize{ReadBigEndian(&(file[position + 4]), 4)};
+        if(position + 8 + chunkSize > file.size())
+        {
+            throw Exception(filename_ + " is truncated");
+        }
+
+        // Unknown chunks are to be skipped
+        if(std::memcmp(&(file[position]), "MTrk", 4) == 0)
+        {
+            std::vector<uint8_t> track(file.begin() + position + 8, file.begin() + position + 8 + chunkSize);
+            ReadTrack(track, trackEvents);
+        }
+
+        position += 8 + chunkSize;
+    }
+
+    TimeEvents(trackEvents);
+}
+
+const std::vector<MIDIFile::Event>& MIDIFile::GetEvents()
+{
+    return events_;
+}
+
+double MIDIFile::GetLength()
+{
+    return length_;
+}
+
+void MIDIFile::ReadTrack(const std::vector<uint8_t>& track, std::vector<TrackEvent>& trackEvents)
+{
+    std::size_t position{0};
+    uint64_t tick{0};
+    uint8_t runningStatus{0};
+
+    auto readByte = [&]() -> uint8_t
+    {
+        if(position >= track.size())
+        {
+            throw Exception(filename_ + " has a track that ends mid event");
+        }
+        return track[position++];
+    };
+
+    // Delta times and lengths are stored 7 bits a byte, the top bit set on all but the last
+    auto readVariableLength = [&]() -> uint32_t
+    {
+        uint32_t value{0};
+        for(int i{0}; i < 4; ++i)
+        {
+            uint8_t byte{readByte()};
+            value = (value << 7) | (byte & 0x7F);
+            if((byte & 0x80) == 0)
+            {
+                break;
+            }
+        }
+        return value;
+    };
+
+    auto addEvent = [&](EventType type, uint8_t note, bool meta, uint32_t microsecondsPerQuarter)
+    {
+        TrackEvent trackEvent{tick, meta, microsecondsPerQuarter, Event{0.0, type, note, {}}};
+        trackEvents.push_back(trackEvent);
+    };
+
+    while(position < track.size())
+    {
+        tick += readVariableLength();
+
+        uint8_t status{readByte()};
+        if(status < 0x80)
+        {
+            // Running status: the byte's the first data byte of another message like the last one
+            if(runningStatus == 0)
+            {
+                throw Exception(filename_ + " has data without a status byte");
+            }
+            --position;
+            status = runningStatus;
+        }
+
+        if(status == metaEvent)
+        {
+            uint8_t metaType{readByte()};
+            uint32_t length{readVariableLength()};
+            if(position + length > track.size())
+            {
+                throw Exception(filename_ + " has a track that ends mid event");
+            }
+
+            if(metaType == tempoMetaType && length == 3)
+            {
+                addEvent(NOTE_OFF, 0, true, ReadBigEndian(&(track[position]), 3));
+            }
+            else
+            {
+                // Still counts toward the length (the end of track event especially)
+                addEvent(NOTE_OFF, 0, true, 0);
+            }
+
+            position += length;
+            continue;
+        }
+
+        if(status == 0xF0 || status == 0xF7)
+        {
+            // 0xF0 events are a SysEx message without its 0xF0, while 0xF7 ones are raw bytes
+            // (continuations and escapes), which the synth has no use for
+            uint32_t length{readVariableLength()};
+            if(position + length > track.size())
+            {
+                throw Exception(filename_ + " has a track that ends mid event");
+            }
+
+            if(status == 0xF0)
+            {
+                addEvent(SYSEX, 0, false, 0);
+                std::vector<uint8_t>& sysEx{trackEvents.back().event.sysEx};
+                sysEx.push_back(0xF0);
+                sysEx.insert(sysEx.end(), track.begin() + position, track.begin() + position + length);
+            }
+
+            position += length;
+            continue;
+        }
+
+        runningStatus = status;
+        uint8_t command{static_cast<uint8_t>(status & 0xF0)};
+        uint8_t data1{readByte()};
+        uint8_t data2{0};
+        if(command != 0xC0 && command != 0xD0)
+        {
+            data2 = readByte();
+        }
+
+        // As in the synth's MIDI receiver, every channel plays and a velocity of 0 is a note off
+        if(command == 0x90 && data2 != 0) { addEvent(NOTE_ON, data1, false, 0); }
+        else if(command == 0x80 || command == 0x90) { addEvent(NOTE_OFF, data1, false, 0); }
+        else if(command == 0xB0 && data1 == allNotesOffController) { addEvent(ALL_NOTES_OFF, 0, false, 0); }
+    }
+}
+
+// Works out each event's time from its tick, walking the tempo changes in order.  The tempo
+// events themselves aren't kept (nor the other meta events, which only set the length).
+void MIDIFile::TimeEvents(std::vector<TrackEvent>& trackEvents)
+{
+    std::stable_sort(trackEvents.begin(), trackEvents.end(), [](const TrackEvent& a, const TrackEvent& b)
+    {
+        return a.tick < b.tick;
+    });
+
+    // A negative top byte is SMPTE timing: frames per second and ticks per frame
+    const bool smpteTiming{(division_ & 0x8000) != 0};
+    const double smpteTicksPerSecond{static_cast<double>(-static_cast<int8_t>(division_ >> 8)) * (division_ & 0xFF)};
+
+    uint32_t microsecondsPerQuarter{defaultMicrosecondsPerQuarter};
+    uint64_t lastTick{0};
+    double time{0.0};
+
+    for(TrackEvent& trackEvent : trackEvents)
+    {
+        uint64_t ticks{trackEvent.tick - lastTick};
+        if(smpteTiming)
+        {
+            time += static_cast<double>(ticks) / smpteTicksPerSecond;
+        }
+        else
+        {
+            time += static_cast<double>(ticks) * microsecondsPerQuarter / (1.0e6 * division_);
+        }
+        lastTick = trackEvent.tick;
+        length_ = time;
+
+        if(trackEvent.meta)
+        {
+            if(trackEvent.microsecondsPerQuarter != 0)
+            {
+                microsecondsPerQuarter = trackEvent.microsecondsPerQuarter;
+            }
+            continue;
+        }
+
+        trackEvent.event.time = time;
+        events_.push_back(trackEvent.event);
+    }
+}
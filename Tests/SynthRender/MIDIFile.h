@@ -0,0 +1,52 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+// Reads a Standard MIDI File (format 0 or 1) into one list of the events the synth responds to,
+// merged across the tracks and timed in seconds using the file's tempo changes.
+class MIDIFile
+{
+    public:
+        enum EventType
+        {
+            NOTE_ON,
+            NOTE_OFF,
+            ALL_NOTES_OFF,
+            SYSEX
+        };
+
+        struct Event
+        {
+            double time;  // In seconds from the start
+            EventType type;
+            uint8_t note;
+            std::vector<uint8_t> sysEx;  // The whole message, from the 0xF0 to the 0xF7
+        };
+
+        MIDIFile(const std::string& filename);
+
+        // In time order.  Events at the same time keep the order they're in within the file.
+        const std::vector<Event>& GetEvents();
+
+        // The time of the last event of any kind (including the end of track), in seconds
+        double GetLength();
+
+    private:
+        struct TrackEvent
+        {
+            uint64_t tick;
+            bool meta;                        // Meta events only set the tempo and the length
+            uint32_t microsecondsPerQuarter;  // Non-zero for a tempo change
+            Event event;
+        };
+
+        void ReadTrack(const std::vector<uint8_t>& track, std::vector<TrackEvent>& trackEvents);
+        void TimeEvents(std::vector<TrackEvent>& trackEvents);
+
+        std::string filename_;
+        uint16_t division_;
+        std::vector<Event> events_;
+        double length_;
+};
@@ -0,0 +1,185 @@
+#include <SynthRender/Patch.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <AudioGeneration/AudioMixer.h>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <vector>
+
+typedef std::function<void(AudioMixer&, const std::string&)> Setting;
+
+std::string Trim(const std::string& text)
+{
+    const char* whitespace{" \t\r\n"};
+    std::size_t start{text.find_first_not_of(whitespace)};
+    if(start == std::string::npos)
+    {
+        return "";
+    }
+
+    return text.substr(start, text.find_last_not_of(whitespace) - start + 1);
+}
+
+// The setters clamp to their own ranges, so this only has to keep the value within the type
+long ParseInteger(const std::string& value, long minimum, long maximum)
+{
+    char* end{nullptr};
+    long number{std::strtol(value.c_str(), &end, 10)};
+    if(value.empty() || *end != '\0' || number < minimum || number > maximum)
+    {
+        throw Exception("\"" + value + "\" isn't a number from " + std::to_string(minimum) + " to " + std::to_string(maximum));
+    }
+
+    return number;
+}
+
+bool ParseBool(const std::string& value)
+{
+    if(value == "true" || value == "on") { return true; }
+    if(value == "false" || value == "off") { return false; }
+    throw Exception("\"" + value + "\" isn't true or false");
+}
+
+// Returns the index of the value in the names
+std::size_t ParseChoice(const std::string& value, const std::vector<std::string>& names)
+{
+    for(std::size_t i{0}; i < names.size(); ++i)
+    {
+        if(value == names[i])
+        {
+            return i;
+        }
+    }
+
+    std::string choices;
+    for(const std::string& name : names)
+    {
+        choices += (choices.empty() ? "" : ", ") + name;
+    }
+    throw Exception("\"" + value + "\" isn't one of " + choices);
+}
+
+uint8_t ParseUnsigned(const std::string& value)
+{
+    return static_cast<uint8_t>(ParseInteger(value, 0, 255));
+}
+
+void AddOscillatorSettings(std::map<std::string, Setting>& settings, const std::string& prefix,
+                           std::function<Oscillator&(AudioMixer&)> getOscillator)
+{
+    // In the same order as the WaveformType enum
+    const std::vector<std::string> waveforms{"None", "Square", "Sawtooth", "Noise", "PinkNoise", "Sample"};
+
+    settings[prefix + ".waveform"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetWaveformType(static_cast<WaveformType>(ParseChoice(value, waveforms))); };
+    settings[prefix + ".level"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetLevel(ParseUnsigned(value)); };
+    settings[prefix + ".cent"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetCent(static_cast<int16_t>(ParseInteger(value, Oscillator::MIN_CENT, Oscillator::MAX_CENT))); };
+    settings[prefix + ".semitone"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetSemitone(static_cast<int8_t>(ParseInteger(value, -128, 127))); };
+    settings[prefix + ".pulse_width"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetPulseWidth(ParseUnsigned(value)); };
+    settings[prefix + ".band_limited"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetBandLimited(ParseBool(value)); };
+    settings[prefix + ".unison"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetUnisonCount(ParseUnsigned(value)); };
+    settings[prefix + ".unison_spread"] = [=](AudioMixer& audioMixer, const std::string& value)
+        { getOscillator(audioMixer).SetUnisonSpread(ParseUnsigned(value)); };
+}
+
+std::map<std::string, Setting> GetSettings()
+{
+    std::map<std::string, Setting> settings;
+
+    AddOscillatorSettings(settings, "oscillator1", [](AudioMixer& audioMixer) -> Oscillator& { return audioMixer.GetOscillator1(); });
+    AddOscillatorSettings(settings, "oscillator2", [](AudioMixer& audioMixer) -> Oscillator& { return audioMixer.GetOscillator2(); });
+    AddOscillatorSettings(settings, "oscillator3", [](AudioMixer& audioMixer) -> Oscillator& { return audioMixer.GetOscillator3(); });
+
+    settings["hard_sync"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.SetHardSync(ParseBool(value)); };
+    settings["fm_amount"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.SetFMAmount(ParseUnsigned(value)); };
+    settings["oversampling"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.SetOversampling(ParseBool(value)); };
+
+    settings["filter.mode"] = [](AudioMixer& audioMixer, const std::string& value)
+        { audioMixer.GetFilter().SetMode(static_cast<FilterMode>(ParseChoice(value, {"Bypass", "LowPass", "BandPass", "HighPass"}))); };
+    settings["filter.cutoff"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetFilter().SetCutoff(ParseUnsigned(value)); };
+    settings["filter.resonance"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetFilter().SetResonance(ParseUnsigned(value)); };
+
+    settings["glide.mode"] = [](AudioMixer& audioMixer, const std::string& value)
+        { audioMixer.GetGlide().SetMode(static_cast<Glide::Mode>(ParseChoice(value, {"Time", "Rate"}))); };
+    settings["glide.time"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetGlide().SetTime(ParseUnsigned(value)); };
+    settings["glide.legato"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetGlide().SetLegato(ParseBool(value)); };
+
+    settings["chorus.mode"] = [](AudioMixer& audioMixer, const std::string& value)
+        { audioMixer.GetChorus().SetMode(static_cast<Chorus::Mode>(ParseChoice(value, {"Off", "Chorus", "Flanger"}))); };
+    settings["chorus.rate"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetChorus().SetRate(ParseUnsigned(value)); };
+    settings["chorus.depth"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetChorus().SetDepth(ParseUnsigned(value)); };
+
+    settings["delay.time"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetDelay().SetTime(ParseUnsigned(value)); };
+    settings["delay.feedback"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetDelay().SetFeedback(ParseUnsigned(value)); };
+    settings["delay.mix"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetDelay().SetMix(ParseUnsigned(value)); };
+
+    settings["reverb.mix"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetReverb().SetMix(ParseUnsigned(value)); };
+    settings["reverb.size"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetReverb().SetSize(ParseUnsigned(value)); };
+
+    settings["tuning.scale"] = [](AudioMixer& audioMixer, const std::string& value)
+        { audioMixer.GetTuning().SetScale(static_cast<Tuning::Scale>(ParseChoice(value, {"Equal", "Just", "Pythagorean", "Meantone"}))); };
+    settings["tuning.reference"] = [](AudioMixer& audioMixer, const std::string& value)
+        { audioMixer.GetTuning().SetReferencePitch(static_cast<uint16_t>(ParseInteger(value, 0, 1000))); };
+
+    settings["output.enabled"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetOutputStage().SetEnabled(ParseBool(value)); };
+    settings["output.gain"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetOutputStage().SetGain(ParseUnsigned(value)); };
+    settings["output.limiter"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetOutputStage().SetLimiter(ParseBool(value)); };
+    settings["output.dither"] = [](AudioMixer& audioMixer, const std::string& value) { audioMixer.GetOutputStage().SetDither(ParseBool(value)); };
+
+    return settings;
+}
+
+void LoadPatch(const std::string& filename, AudioMixer& audioMixer)
+{
+    std::ifstream fileStream(filename);
+    if(!fileStream.is_open())
+    {
+        throw Exception("Failed to open patch " + filename);
+    }
+
+    const std::map<std::string, Setting> settings{GetSettings()};
+
+    std::string line;
+    std::size_t lineNumber{0};
+    while(std::getline(fileStream, line))
+    {
+        ++lineNumber;
+        std::string where{filename + " line " + std::to_string(lineNumber) + ": "};
+
+        line = Trim(line.substr(0, line.find('#')));
+        if(line.empty())
+        {
+            continue;
+        }
+
+        std::size_t equals{line.find('=')};
+        if(equals == std::string::npos)
+        {
+            throw Exception(where + "expected \"setting = value\"");
+        }
+
+        std::string name{Trim(line.substr(0, equals))};
+        std::string value{Trim(line.substr(equals + 1))};
+        auto setting{settings.find(name)};
+        if(setting == settings.end())
+        {
+            throw Exception(where + "there's no setting called " + name);
+        }
+
+        try
+        {
+            setting->second(audioMixer, value);
+        }
+        catch(const Exception& exception)
+        {
+            throw Exception(where + name + ": " + exception.what());
+        }
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+
+class AudioMixer;
+
+// Sets up an AudioMixer from a patch file.  A patch is a list of "setting = value" lines, one per
+// setting, with anything after a '#' ignored.  Settings that aren't mentioned keep the synth's
+// defaults.  For example:
+//
+//     oscillator1.waveform = Sawtooth
+//     oscillator1.level = 40
+//     oscillator2.semitone = 12
+//     oscillator2.cent = -5
+//     filter.mode = LowPass
+//     filter.cutoff = 70
+//
+// The oscillator settings are waveform (None, Square, Sawtooth, Noise, PinkNoise or Sample), level,
+// cent, semitone, pulse_width, band_limited, unison and unison_spread.  See Patch.cpp for the rest.
+// Numbers are the same as the synth's menu shows, and on/off settings take true or false.
+void LoadPatch(const std::string& filename, AudioMixer& audioMixer);
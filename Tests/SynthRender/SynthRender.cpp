@@ -0,0 +1,368 @@
+#include <SynthRender/MIDIFile.h>
+#include <SynthRender/Patch.h>
+#include <AudioGeneration-UT/WaveFileWriter.h>
+#include <AudioGeneration-UT/ThreadPool.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <AudioGeneration/AudioMixer.h>
+#include <AudioGeneration/AudioSettings.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Plays a Standard MIDI File through the synth and writes the result to a wave file, as fast as it
+// can render, then reports how many times faster than real time that was.
+//
+//     synth-render <input.mid> <output.wav> [--patch file] [--format 16|24|float] [--tail seconds]
+//                  [--block-size samples]
+//     synth-render --batch <jobs file> [--jobs threads]
+//
+// Like the synth itself it's monophonic and plays the most recently pressed key that's still held,
+// whatever its channel.  MIDI Tuning Standard SysEx messages retune it.  The tail is how long it
+// carries on rendering after the file ends, for releases and the effects to ring out.
+//
+// A batch renders many files at once, one job per line of the jobs file.  Each line has the same
+// arguments as a single render (blank lines and anything after a '#' are ignored), and the jobs
+// are shared out over a thread pool, one per core unless --jobs says otherwise.  Every job has its
+// own AudioMixer, so the files come out just as they would have one at a time.
+
+struct Options
+{
+    std::string midiFilename;
+    std::string outputFilename;
+    std::string patchFilename;
+    WaveFileWriter::Format format{WaveFileWriter::PCM_16_BIT};
+    double tailSeconds{2.0};
+    std::size_t blockSize{256};  // The firmware's DMA buffer size (see AudioOutput)
+};
+
+void PrintUsage()
+{
+    std::fprintf(stderr, "Usage: synth-render <input.mid> <output.wav> [--patch file] [--format 16|24|float] [--tail seconds] [--block-size samples]\n");
+    std::fprintf(stderr, "       synth-render --batch <jobs file> [--jobs threads]\n");
+}
+
+bool ParseOptions(const std::vector<std::string>& arguments, Options& options)
+{
+    if(arguments.size() < 2)
+    {
+        return false;
+    }
+
+    options.midiFilename = arguments[0];
+    options.outputFilename = arguments[1];
+
+    for(std::size_t i{2}; i < arguments.size(); ++i)
+    {
+        const std::string& option{arguments[i]};
+        bool hasValue{i + 1 < arguments.size()};
+        if(option == "--patch" && hasValue)
+        {
+            options.patchFilename = arguments[++i];
+        }
+        else if(option == "--format" && hasValue)
+        {
+            const std::string& format{arguments[++i]};
+            if(format == "16") { options.format = WaveFileWriter::PCM_16_BIT; }
+            else if(format == "24") { options.format = WaveFileWriter::PCM_24_BIT; }
+            else if(format == "float") { options.format = WaveFileWriter::FLOAT_32_BIT; }
+            else { return false; }
+        }
+        else if(option == "--tail" && hasValue)
+        {
+            options.tailSeconds = std::atof(arguments[++i].c_str());
+        }
+        else if(option == "--block-size" && hasValue)
+        {
+            options.blockSize = std::strtoul(arguments[++i].c_str(), nullptr, 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return options.tailSeconds >= 0.0 && options.blockSize > 0;
+}
+
+// Reads a jobs file into the options for each render
+std::vector<Options> ReadJobs(const std::string& filename)
+{
+    std::ifstream fileStream(filename);
+    if(!fileStream.is_open())
+    {
+        throw Exception("Failed to open jobs file " + filename);
+    }
+
+    std::vector<Options> jobs;
+    std::string line;
+    std::size_t lineNumber{0};
+    while(std::getline(fileStream, line))
+    {
+        ++lineNumber;
+
+        std::istringstream lineStream{line.substr(0, line.find('#'))};
+        std::vector<std::string> arguments;
+        std::string argument;
+        while(lineStream >> argument)
+        {
+            arguments.push_back(argument);
+        }
+
+        if(arguments.empty())
+        {
+            continue;
+        }
+
+        Options options;
+        if(!ParseOptions(arguments, options))
+        {
+            throw Exception(filename + " line " + std::to_string(lineNumber) + ": expected <input.mid> <output.wav> [options]");
+        }
+        jobs.push_back(options);
+    }
+
+    if(jobs.empty())
+    {
+        throw Exception(filename + " has no jobs in it");
+    }
+
+    return jobs;
+}
+
+// Keeps track of the held keys the way the synth's MIDI receiver does: each held key remembers
+// when it was pressed, and the most recent one is the one that plays.
+class HeldKeys
+{
+    public:
+        HeldKeys() : pressCount_{0}
+        {
+            ReleaseAll();
+        }
+
+        void Press(uint8_t note) { pressOrder_[note & 0x7F] = ++pressCount_; }
+        void Release(uint8_t note) { pressOrder_[note & 0x7F] = 0; }
+
+        void ReleaseAll()
+        {
+            for(uint32_t& order : pressOrder_)
+            {
+                order = 0;
+            }
+        }
+
+        // Note 0 doubles as "no note" for the AudioMixer, as it does on the synth
+        uint8_t GetMostRecent()
+        {
+            uint8_t mostRecent{0};
+            for(uint8_t note{0}; note < 128; ++note)
+            {
+                if(pressOrder_[note] > pressOrder_[mostRecent])
+                {
+                    mostRecent = note;
+                }
+            }
+            return mostRecent;
+        }
+
+    private:
+        uint32_t pressCount_;
+        uint32_t pressOrder_[128];
+};
+
+struct RenderStats
+{
+    std::size_t eventCount;
+    double audioSeconds;
+    double renderSeconds;  // Just the time spent in the AudioMixer
+    double totalSeconds;   // Including reading the files and writing the output
+};
+
+// The AudioMixer's constructed by the caller, because its constructor rebuilds the note and filter
+// tables all the mixers share, which mustn't happen while another thread's rendering.
+RenderStats Render(const Options& options, AudioMixer& audioMixer)
+{
+    auto startTime{std::chrono::steady_clock::now()};
+
+    MIDIFile midiFile(options.midiFilename);
+    if(!options.patchFilename.empty())
+    {
+        LoadPatch(options.patchFilename, audioMixer);
+    }
+
+    const double sampleRate{SAMPLE_RATE};
+    const std::size_t totalSamples{static_cast<std::size_t>(std::ceil((midiFile.GetLength() + options.tailSeconds) * sampleRate))};
+    const std::vector<MIDIFile::Event>& events{midiFile.GetEvents()};
+
+    WaveFileWriter waveFileWriter(options.outputFilename, static_cast<std::size_t>(sampleRate), options.format);
+    std::vector<uint16_t> buffer(options.blockSize);
+    HeldKeys heldKeys;
+    std::size_t nextEvent{0};
+    std::chrono::duration<double> renderTime{0.0};
+
+    std::size_t position{0};
+    while(position < totalSamples)
+    {
+        // Everything due by now happens before the next sample's rendered
+        for(; nextEvent < events.size() && static_cast<std::size_t>(events[nextEvent].time * sampleRate + 0.5) <= position; ++nextEvent)
+        {
+            const MIDIFile::Event& event{events[nextEvent]};
+            if(event.type == MIDIFile::NOTE_ON) { heldKeys.Press(event.note); }
+            else if(event.type == MIDIFile::NOTE_OFF) { heldKeys.Release(event.note); }
+            else if(event.type == MIDIFile::ALL_NOTES_OFF) { heldKeys.ReleaseAll(); }
+            else { audioMixer.GetTuning().HandleSysEx(event.sysEx.data(), static_cast<uint32_t>(event.sysEx.size())); }
+            audioMixer.SetMIDINote(heldKeys.GetMostRecent());
+        }
+
+        // Render up to the next event, a block at most
+        std::size_t renderSize{std::min(options.blockSize, totalSamples - position)};
+        if(nextEvent < events.size())
+        {
+            std::size_t eventPosition{static_cast<std::size_t>(events[nextEvent].time * sampleRate + 0.5)};
+            renderSize = std::min(renderSize, eventPosition - position);
+        }
+
+        auto renderStart{std::chrono::steady_clock::now()};
+        audioMixer.GetAudioData(buffer.data(), static_cast<uint32_t>(renderSize));
+        renderTime += std::chrono::steady_clock::now() - renderStart;
+
+        waveFileWriter.AppendAudioData(buffer.data(), renderSize);
+        position += renderSize;
+    }
+
+    waveFileWriter.Close();
+    std::chrono::duration<double> totalTime{std::chrono::steady_clock::now() - startTime};
+
+    return RenderStats{events.size(), static_cast<double>(totalSamples) / sampleRate, renderTime.count(), totalTime.count()};
+}
+
+int RenderOne(const Options& options)
+{
+    // The mixer's too big to be comfortable on the stack with its effects' delay lines
+    std::unique_ptr<AudioMixer> audioMixer{new AudioMixer};
+    RenderStats stats{Render(options, *audioMixer)};
+
+    std::printf("Rendered %.2f s of audio (%zu events) to %s\n", stats.audioSeconds, stats.eventCount, options.outputFilename.c_str());
+    std::printf("Render:  %8.3f s, %8.1fx real time, %6.2f ns/sample\n", stats.renderSeconds,
+        stats.audioSeconds / stats.renderSeconds, stats.renderSeconds * 1.0e9 / (stats.audioSeconds * SAMPLE_RATE));
+    std::printf("Overall: %8.3f s, %8.1fx real time (including writing the file)\n", stats.totalSeconds,
+        stats.audioSeconds / stats.totalSeconds);
+
+    return 0;
+}
+
+std::string GetErrorMessage(std::exception_ptr error)
+{
+    try
+    {
+        std::rethrow_exception(error);
+    }
+    catch(const std::exception& exception)
+    {
+        return exception.what();
+    }
+    catch(...)
+    {
+        return "unknown error";
+    }
+}
+
+int RenderBatch(const std::string& jobsFilename, std::size_t threadCount)
+{
+    std::vector<Options> jobOptions{ReadJobs(jobsFilename)};
+
+    std::vector<std::unique_ptr<AudioMixer>> audioMixers;
+    for(std::size_t i{0}; i < jobOptions.size(); ++i)
+    {
+        audioMixers.emplace_back(new AudioMixer);
+    }
+
+    std::vector<RenderStats> stats(jobOptions.size(), RenderStats{0, 0.0, 0.0, 0.0});
+    std::vector<std::function<void()>> jobs;
+    for(std::size_t i{0}; i < jobOptions.size(); ++i)
+    {
+        jobs.push_back([&, i]()
+        {
+            stats[i] = Render(jobOptions[i], *audioMixers[i]);
+            audioMixers[i].reset();
+        });
+    }
+
+    ThreadPool threadPool(threadCount);
+    auto startTime{std::chrono::steady_clock::now()};
+    std::vector<ThreadPool::JobResult> results{threadPool.Run(jobs)};
+    std::chrono::duration<double> wallTime{std::chrono::steady_clock::now() - startTime};
+
+    // Reported in the jobs file's order, whichever order they finished in
+    std::printf("%4s  %-40s %9s %9s %10s %7s\n", "Job", "Output", "Audio s", "Job s", "x Real", "Worker");
+    std::size_t failureCount{0};
+    double summedJobTime{0.0};
+    for(std::size_t i{0}; i < results.size(); ++i)
+    {
+        summedJobTime += results[i].seconds;
+        if(results[i].error)
+        {
+            ++failureCount;
+            std::printf("%4zu  %-40s FAILED: %s\n", i + 1, jobOptions[i].outputFilename.c_str(), GetErrorMessage(results[i].error).c_str());
+            continue;
+        }
+
+        std::printf("%4zu  %-40s %9.2f %9.3f %10.1f %7zu\n", i + 1, jobOptions[i].outputFilename.c_str(),
+            stats[i].audioSeconds, results[i].seconds, stats[i].audioSeconds / results[i].seconds, results[i].worker);
+    }
+
+    std::printf("%zu jobs on %zu threads: %.3f s, against %.3f s of job time one after another (%.2fx)\n", results.size(),
+        threadPool.GetThreadCount(), wallTime.count(), summedJobTime, summedJobTime / wallTime.count());
+
+    if(failureCount > 0)
+    {
+        std::fflush(stdout);
+        std::fprintf(stderr, "synth-render: %zu of %zu jobs failed\n", failureCount, results.size());
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> arguments(argv + 1, argv + argc);
+
+    try
+    {
+        if(!arguments.empty() && arguments[0] == "--batch")
+        {
+            std::size_t threadCount{0};
+            if(arguments.size() == 4 && arguments[2] == "--jobs")
+            {
+                threadCount = std::strtoul(arguments[3].c_str(), nullptr, 10);
+            }
+            else if(arguments.size() != 2)
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            return RenderBatch(arguments[1], threadCount);
+        }
+
+        Options options;
+        if(!ParseOptions(arguments, options))
+        {
+            PrintUsage();
+            return 1;
+        }
+
+        return RenderOne(options);
+    }
+    catch(const Exception& exception)
+    {
+        std::fprintf(stderr, "synth-render: %s\n", exception.what());
+        return 1;
+    }
+}
@@ -0,0 +1,168 @@
+#include <AudioGeneration-UT/WaveFileReader.h>
+#include <AudioGeneration-UT/Exception.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <fstream>
+#include <string>
+
+// Converts a wave file into the const PCM array and SampleData the Sample waveform plays from
+// flash.  It writes <output>.h, declaring the SampleData, and <output>.cpp, defining it.
+//
+//     WaveToSample <input.wav> <output> <name> [--bits 8|16] [--root-frequency Hz] [--loop start end]
+//
+// The loop comes from the wave file's smpl chunk unless it's given here (the end is exclusive), and
+// the root frequency defaults to middle C.
+
+const std::size_t valuesPerLine{12};
+
+struct Options
+{
+    std::string inputFilename;
+    std::string outputPath;
+    std::string name;
+    int bits{16};
+    double rootFrequency{261.63};
+    bool loopGiven{false};
+    std::size_t loopStart{0};
+    std::size_t loopEnd{0};
+};
+
+void PrintUsage()
+{
+    std::fprintf(stderr, "Usage: WaveToSample <input.wav> <output> <name> [--bits 8|16] [--root-frequency Hz] [--loop start end]\n");
+}
+
+bool ParseOptions(int argc, char* argv[], Options& options)
+{
+    if(argc < 4)
+    {
+        return false;
+    }
+
+    options.inputFilename = argv[1];
+    options.outputPath = argv[2];
+    options.name = argv[3];
+
+    for(int i{4}; i < argc; ++i)
+    {
+        std::string option{argv[i]};
+        if(option == "--bits" && i + 1 < argc)
+        {
+            options.bits = std::atoi(argv[++i]);
+        }
+        else if(option == "--root-frequency" && i + 1 < argc)
+        {
+            options.rootFrequency = std::atof(argv[++i]);
+        }
+        else if(option == "--loop" && i + 2 < argc)
+        {
+            options.loopGiven = true;
+            options.loopStart = std::strtoul(argv[++i], nullptr, 10);
+            options.loopEnd = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return (options.bits == 8 || options.bits == 16) && options.rootFrequency > 0.0;
+}
+
+// Only the file name, as the generated files are included relative to the source directory
+std::string GetFilename(const std::string& path)
+{
+    std::size_t separator{path.find_last_of("/\\")};
+    return (separator == std::string::npos) ? path : path.substr(separator + 1);
+}
+
+void WriteHeader(const Options& options)
+{
+    std::ofstream header(options.outputPath + ".h");
+    header << "// Generated by WaveToSample from " << GetFilename(options.inputFilename) << ", don't edit by hand\n\n";
+    header << "#pragma once\n\n";
+    header << "#include \"AudioGeneration/SampleData.h\"\n\n";
+    header << "extern const SampleData " << options.name << ";\n";
+
+    if(!header.good())
+    {
+        throw Exception("Failed to write " + options.outputPath + ".h");
+    }
+}
+
+void WriteSource(const Options& options, const std::vector<float>& samples, std::size_t sampleRate, std::size_t loopStart, std::size_t loopEnd)
+{
+    const bool eightBit{options.bits == 8};
+    const double fullScale{eightBit ? 128.0 : 32768.0};
+    const std::string dataName{options.name + "Data"};
+
+    std::ofstream source(options.outputPath + ".cpp");
+    source << "// Generated by WaveToSample from " << GetFilename(options.inputFilename) << ", don't edit by hand\n\n";
+    source << "#include \"AudioGeneration/Samples/" << GetFilename(options.outputPath) << ".h\"\n\n";
+    source << "const " << (eightBit ? "int8_t " : "int16_t ") << dataName << "[" << samples.size() << "] =\n{";
+
+    for(std::size_t i{0}; i < samples.size(); ++i)
+    {
+        double value{std::floor(samples[i] * fullScale + 0.5)};
+        if(value > fullScale - 1.0) { value = fullScale - 1.0; }
+        else if(value < -fullScale) { value = -fullScale; }
+
+        source << ((i % valuesPerLine) ? " " : "\n    ") << static_cast<int>(value) << ((i + 1 < samples.size()) ? "," : "");
+    }
+
+    source << "\n};\n\n";
+    source << "const SampleData " << options.name << " =\n{\n";
+    source << "    " << (eightBit ? dataName : "0") << ",\n";
+    source << "    " << (eightBit ? "0" : dataName) << ",\n";
+    source << "    " << samples.size() << ",\n";
+    source << "    " << loopStart << ",\n";
+    source << "    " << loopEnd << ",\n";
+    source << "    " << sampleRate << ".0f,\n";
+
+    char rootFrequency[32];
+    std::snprintf(rootFrequency, sizeof(rootFrequency), "%.4ff", options.rootFrequency);
+    source << "    " << rootFrequency << "\n};\n";
+
+    if(!source.good())
+    {
+        throw Exception("Failed to write " + options.outputPath + ".cpp");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if(!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    try
+    {
+        WaveFileReader reader(options.inputFilename);
+        const std::vector<float>& samples{reader.GetSamples()};
+
+        std::size_t loopStart{options.loopGiven ? options.loopStart : reader.GetLoopStart()};
+        std::size_t loopEnd{options.loopGiven ? options.loopEnd : reader.GetLoopEnd()};
+        if(loopEnd > samples.size() || loopStart >= loopEnd)
+        {
+            loopStart = 0;
+            loopEnd = 0;
+        }
+
+        WriteHeader(options);
+        WriteSource(options, samples, reader.GetSampleRate(), loopStart, loopEnd);
+
+        std::printf("%s: %zu samples at %zu Hz, %d bit, %zu bytes of flash\n", options.name.c_str(), samples.size(),
+            reader.GetSampleRate(), options.bits, samples.size() * options.bits / 8);
+    }
+    catch(const Exception& exception)
+    {
+        std::fprintf(stderr, "WaveToSample: %s\n", exception.what());
+        return 1;
+    }
+
+    return 0;
+}